@@ -0,0 +1,58 @@
+// src/core/BrushStroke.cpp
+#include "src/core/BrushStroke.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+
+const std::vector<CellSpan>& BrushStroke::rasterize(int fromX, int fromY, int toX, int toY, int radius, int width, int height) {
+	spans.clear();
+
+	// Same circle as the single-point brush: dx*dx + dy*dy <= r2
+	int r2 = std::max(1, radius * radius - 1);
+	int reach = r2 == 1 ? 0 : radius;
+	halfWidths.assign(2 * reach + 1, -1);
+	for (int dy = -reach; dy <= reach; ++dy) {
+		int rest = r2 - dy * dy;
+		if (reach == 0) {
+			halfWidths[0] = 0;
+		} else if (rest >= 0) {
+			int half = static_cast<int>(std::sqrt(static_cast<double>(rest)));
+			while ((half + 1) * (half + 1) <= rest) ++half;
+			while (half * half > rest) --half;
+			halfWidths[dy + reach] = half;
+		}
+	}
+
+	int minY = std::max(0, std::min(fromY, toY) - reach);
+	int maxY = std::min(height - 1, std::max(fromY, toY) + reach);
+	if (minY > maxY) return spans;
+
+	// Widen each row's extent by every circle along the path
+	rowLeft.assign(maxY - minY + 1, INT_MAX);
+	rowRight.assign(maxY - minY + 1, INT_MIN);
+	int dx = toX - fromX;
+	int dy = toY - fromY;
+	int steps = std::max(std::abs(dx), std::abs(dy));
+	for (int i = 0; i <= steps; ++i) {
+		int centerX = steps ? fromX + dx * i / steps : fromX;
+		int centerY = steps ? fromY + dy * i / steps : fromY;
+		for (int offset = -reach; offset <= reach; ++offset) {
+			int y = centerY + offset;
+			int half = halfWidths[offset + reach];
+			if (y < minY || y > maxY || half < 0) continue;
+			int row = y - minY;
+			rowLeft[row] = std::min(rowLeft[row], centerX - half);
+			rowRight[row] = std::max(rowRight[row], centerX + half);
+		}
+	}
+
+	for (int row = 0; row <= maxY - minY; ++row) {
+		int x0 = std::max(rowLeft[row], 0);
+		int x1 = std::min(rowRight[row], width - 1);
+		if (x0 <= x1) {
+			spans.push_back({minY + row, x0, x1});
+		}
+	}
+	return spans;
+}
@@ -0,0 +1,42 @@
+// src/core/BrushStroke.hpp
+#ifndef BRUSH_STROKE_HPP
+#define BRUSH_STROKE_HPP
+
+#include <vector>
+
+/**
+ * @brief A horizontal run of cells [x0, x1] on row y (inclusive).
+ */
+struct CellSpan {
+	int y;
+	int x0;
+	int x1;
+};
+
+/**
+ * @brief Rasterizes brush strokes into horizontal spans.
+ *
+ * A stroke is the union of the brush circles at every step between two grid
+ * positions. It is built as one span per covered row, clipped to the world,
+ * so each cell under the stroke is visited exactly once no matter how many
+ * circles overlap it. Scratch buffers are kept between strokes.
+ */
+class BrushStroke {
+public:
+	/**
+	 * @brief Rasterize the stroke from (fromX, fromY) to (toX, toY).
+	 * @param radius Brush radius in cells; 1 or less covers a single cell per step
+	 * @param width World width used for clipping
+	 * @param height World height used for clipping
+	 * @return Spans sorted by row, at most one per row; valid until the next call
+	 */
+	const std::vector<CellSpan>& rasterize(int fromX, int fromY, int toX, int toY, int radius, int width, int height);
+
+private:
+	std::vector<int> halfWidths; ///< Circle half width per row offset, -1 if the row is not covered
+	std::vector<int> rowLeft;
+	std::vector<int> rowRight;
+	std::vector<CellSpan> spans;
+};
+
+#endif // BRUSH_STROKE_HPP
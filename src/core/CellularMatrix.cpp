@@ -3,30 +3,63 @@
 #include "src/elements/types/Empty.hpp"
 #include "src/core/Globals.hpp"
 #include "src/core/Renderer.hpp"
+#include "src/elements/Reactions.hpp"
 #include <algorithm>
+#include <bitset>
+#include <climits>
+#include <cmath>
 #include <random>
 #include <utility>
 #include <iostream>
+#include <unordered_map>
 
 //-------------------------------------------
 // Construction/Destruction
 //-------------------------------------------
 CellularMatrix::CellularMatrix(int width, int height)
-	: pixels(width * height)
+	: width(width),
+	height(height),
+	chunksX((width + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE),
+	chunksY((height + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE)
 {
-	// Initialize chunks before matrix ---
-	for (int chunkY = 0; chunkY < g_CHUNKS_Y; ++chunkY) {
-		for (int chunkX = 0; chunkX < g_CHUNKS_X; ++chunkX) {
-			chunks[chunkY][chunkX] = Chunk(chunkX, chunkY);
-		}
+	// The world starts out empty, so no chunk is materialized yet
+	directoryWidth = chunksX + 2;
+	chunks.assign(static_cast<size_t>(directoryWidth) * (chunksY + 2), nullptr);
+	rowLiveCount.assign(chunksY, 0);
+	gasField.resize(width, height);
+	temperatureField.resize(width, height);
+	combustion.resize(width, height);
+
+	// --- Ghost ring: every tile around the world reads as WALL ---
+	for (int i = 0; i < Chunk::CELL_COUNT; ++i) {
+		wallChunk.getCells()[i] = &wallCell;
+	}
+	for (int chunkX = -1; chunkX <= chunksX; ++chunkX) {
+		directoryEntry(chunkX, -1) = &wallChunk;
+		directoryEntry(chunkX, chunksY) = &wallChunk;
+	}
+	for (int chunkY = 0; chunkY < chunksY; ++chunkY) {
+		directoryEntry(-1, chunkY) = &wallChunk;
+		directoryEntry(chunksX, chunkY) = &wallChunk;
 	}
 
-	// --- Use reserve for matrix rows to avoid reallocations ---
-	for (int y = 0; y < height; ++y) {
-		for (int x = 0; x < width; ++x) {
-			matrix[y][x] = new Empty(x, y); 
+	// Chunks cut off by the world edge hold the rest of the border and are never released
+	if (width % g_CHUNK_SIZE != 0) {
+		for (int chunkY = 0; chunkY < chunksY; ++chunkY) {
+			materializeChunk(chunksX - 1, chunkY);
+		}
+	}
+	if (height % g_CHUNK_SIZE != 0) {
+		for (int chunkX = 0; chunkX < chunksX; ++chunkX) {
+			if (!chunkAt(chunkX, chunksY - 1)) {
+				materializeChunk(chunkX, chunksY - 1);
+			}
 		}
 	}
+
+	columnOrder.reserve(width);
+	activeChunkColumns.reserve(chunksX);
+	ParticleManager::setBounds(width, height);
 }
 
 CellularMatrix::~CellularMatrix() {
@@ -34,185 +67,587 @@ CellularMatrix::~CellularMatrix() {
 	if (renderTexture) {
 		SDL_DestroyTexture(renderTexture);
 	}
+	if (heatmapTexture) {
+		SDL_DestroyTexture(heatmapTexture);
+	}
 	
-	// Clean up all elements in the grid
-	for (int y = 0; y < Matrix::HEIGHT; ++y) {
-		for (int x = 0; x < Matrix::WIDTH; ++x) {
-			if (matrix[y][x]) {
-				delete matrix[y][x];
-				matrix[y][x] = nullptr;
-			}
+	// Clean up all materialized chunks and their elements
+	for (Chunk* chunk : liveChunks) {
+		for (Element* cell : chunk->cells) {
+			delete cell;
 		}
+		delete chunk;
 	}
 }
 
 //-------------------------------------------
-// IMatrixAccess Implementation
+// Sparse Storage
 //-------------------------------------------
-bool CellularMatrix::isInBounds(int x, int y) const {
-	return x >= 0 && x < Matrix::WIDTH && y >= 0 && y < Matrix::HEIGHT;
+Element*& CellularMatrix::materializedCellAt(int x, int y) {
+	Chunk* chunk = chunkContaining(x, y);
+	if (!chunk) {
+		chunk = &materializeChunk(getChunkX(x), getChunkY(y));
+	}
+	return chunk->cellAt(getLocal(x), getLocal(y));
 }
 
-bool CellularMatrix::isEmpty(int x, int y) const {
-	return matrix[y][x]->getType() == EMPTY;
-}
+// Without fillEmpty the cells inside the world are left null for the caller to fill
+Chunk& CellularMatrix::materializeChunk(int chunkX, int chunkY, bool fillEmpty) {
+	Chunk* chunk = new Chunk(chunkX, chunkY);
+	int worldX = chunk->getWorldX();
+	int worldY = chunk->getWorldY();
+	for (int localY = 0; localY < g_CHUNK_SIZE; ++localY) {
+		for (int localX = 0; localX < g_CHUNK_SIZE; ++localX) {
+			int x = worldX + localX;
+			int y = worldY + localY;
+			if (x < width && y < height) {
+				if (fillEmpty) {
+					chunk->cellAt(localX, localY) = new Empty(x, y);
+					chunk->setCellEmpty(localX, localY, true);
+				}
+			} else {
+				chunk->cellAt(localX, localY) = new Wall(x, y);
+			}
+		}
+	}
 
-Element*& CellularMatrix::getElement(int x, int y) {
-	return matrix[y][x];
+	directoryEntry(chunkX, chunkY) = chunk;
+	chunk->liveIndex = static_cast<int>(liveChunks.size());
+	liveChunks.push_back(chunk);
+	++rowLiveCount[chunkY];
+	return *chunk;
 }
 
-const Element* CellularMatrix::getElement(int x, int y) const {
-	return matrix[y][x];
+void CellularMatrix::releaseChunk(Chunk* chunk) {
+	// Swap-remove from the live list
+	Chunk* last = liveChunks.back();
+	liveChunks[chunk->liveIndex] = last;
+	last->liveIndex = chunk->liveIndex;
+	liveChunks.pop_back();
+
+	directoryEntry(chunk->getChunkX(), chunk->getChunkY()) = nullptr;
+	--rowLiveCount[chunk->getChunkY()];
+	releasedTiles.push_back({chunk->getChunkX(), chunk->getChunkY()});
+	for (Element* cell : chunk->cells) {
+		delete cell;
+	}
+	delete chunk;
 }
 
+//-------------------------------------------
+// IMatrixAccess Implementation
+//-------------------------------------------
 void CellularMatrix::destroyElement(int x, int y) {
-	if (matrix[y][x]->getType() != EMPTY) {
+	// Unmaterialized tiles are already empty, and the border is immutable
+	if (isInBounds(x, y) && cellAt(x, y)->getType() != EMPTY) {
+		Element*& cell = materializedCellAt(x, y);
 		Element* emptyElement = ElementFactory::createElementFromType(EMPTY, x, y);
-		Element* oldElement = matrix[y][x];
-		matrix[y][x] = emptyElement;
+		Element* oldElement = cell;
+		cell = emptyElement;
 		delete oldElement;
+		syncEmptyBit(x, y);
+		chunkContaining(x, y)->markTextureDirty();
+		wakeNeighborhood(x, y);
 	}
 }
 
 //-------------------------------------------
 // Rendering Setup
 //-------------------------------------------
-void CellularMatrix::initializeTexture(SDL_Renderer* renderer) {
+void CellularMatrix::initializeTexture(SDL_Renderer* renderer, int viewWidth, int viewHeight) {
 	// Clean up existing texture if any
 	if (renderTexture) {
 		SDL_DestroyTexture(renderTexture);
 	}
 
+	// The texture only covers the visible part of the world
+	this->viewWidth = viewWidth;
+	this->viewHeight = viewHeight;
+	pixels.assign(static_cast<size_t>(viewWidth) * viewHeight, 0);
+	basePixels.assign(static_cast<size_t>(viewWidth) * viewHeight, 0);
+	fullConversionPending = true;
+
 	// Create streaming texture for efficient updates
 	renderTexture = SDL_CreateTexture(
 		renderer, 
 		SDL_PIXELFORMAT_RGBA8888,
 		SDL_TEXTUREACCESS_STREAMING,
-		Matrix::WIDTH,
-		Matrix::HEIGHT
+		viewWidth,
+		viewHeight
 	);
 	SDL_SetTextureBlendMode(renderTexture, SDL_BLENDMODE_BLEND);
+
+	// Low-resolution heatmap texture, one texel per chunk the view can overlap
+	if (heatmapTexture) {
+		SDL_DestroyTexture(heatmapTexture);
+	}
+	heatmapWidth = viewWidth / g_CHUNK_SIZE + 2;
+	heatmapHeight = viewHeight / g_CHUNK_SIZE + 2;
+	heatmapPixels.assign(static_cast<size_t>(heatmapWidth) * heatmapHeight, 0);
+	heatmapTexture = SDL_CreateTexture(
+		renderer,
+		SDL_PIXELFORMAT_RGBA8888,
+		SDL_TEXTUREACCESS_STREAMING,
+		heatmapWidth,
+		heatmapHeight
+	);
+	SDL_SetTextureBlendMode(heatmapTexture, SDL_BLENDMODE_BLEND);
 }
 
 //-------------------------------------------
 // Element Management
 //-------------------------------------------
 void CellularMatrix::placeElement(int x, int y, ElementType type) {
-	if (x >= 0 && x < Matrix::WIDTH && y >= 0 && y < Matrix::HEIGHT) {
-		if (matrix[y][x] && matrix[y][x]->getType() == type) {
+	if (isInBounds(x, y)) {
+		// Also covers erasing inside an unmaterialized tile
+		if (cellAt(x, y)->getType() == type) {
 			return;
 		}
+		Element*& cell = materializedCellAt(x, y);
 		Element* newElement = ElementFactory::createElementFromType(type, x, y);
-		delete matrix[y][x]; // delete old element
-		matrix[y][x] = newElement;
+		delete cell; // delete old element
+		cell = newElement;
+		syncEmptyBit(x, y);
+		chunkContaining(x, y)->markTextureDirty();
 		
-		// Activate the chunk containing this element
-		activateChunk(x, y);
+		// Wake the new element and everything around it
+		wakeNeighborhood(x, y);
 	}
 }
 
 void CellularMatrix::placeElementsInArea(int centerX, int centerY, int radius, ElementType type) {
-	int r2 = std::max(1, radius * radius - 1);
-	if (r2 == 1) {
-		placeElement(centerX, centerY, type);
-		return;
+	placeElementsAlongStroke(centerX, centerY, centerX, centerY, radius, type);
+}
+
+void CellularMatrix::placeElementsAlongStroke(int fromX, int fromY, int toX, int toY, int radius, ElementType type) {
+	placeElementsInSpans(brushStroke.rasterize(fromX, fromY, toX, toY, radius, width, height), type);
+}
+
+//-------------------------------------------
+// Bulk Region Operations
+//-------------------------------------------
+std::vector<SDL_Point> CellularMatrix::placeElementsInSpans(const std::vector<CellSpan>& spans, ElementType type) {
+	splitSpansByChunk(spans);
+	return placeChunkSpans([type](int, int) { return type; });
+}
+
+void CellularMatrix::splitSpansByChunk(const std::vector<CellSpan>& spans) {
+	// Clip to the world and split at chunk borders, then group the pieces by chunk
+	chunkSpans.clear();
+	for (const CellSpan& span : spans) {
+		if (span.y < 0 || span.y >= height) continue;
+		int x0 = std::max(span.x0, 0);
+		int x1 = std::min(span.x1, width - 1);
+		while (x0 <= x1) {
+			int chunkX = getChunkX(x0);
+			int pieceEnd = std::min(x1, (chunkX + 1) * g_CHUNK_SIZE - 1);
+			chunkSpans.push_back({chunkX, getChunkY(span.y), {span.y, x0, pieceEnd}});
+			x0 = pieceEnd + 1;
+		}
+	}
+	if (chunkSpans.empty()) return;
+
+	// Counting sort by directory index; pieces of one chunk keep their order
+	auto directoryIndex = [this](const ChunkSpan& piece) {
+		return (piece.chunkY + 1) * directoryWidth + piece.chunkX + 1;
+	};
+	int firstIndex = directoryIndex(chunkSpans.front());
+	int lastIndex = firstIndex;
+	for (const ChunkSpan& piece : chunkSpans) {
+		firstIndex = std::min(firstIndex, directoryIndex(piece));
+		lastIndex = std::max(lastIndex, directoryIndex(piece));
 	}
-	for (int y = centerY - radius; y <= centerY + radius; ++y) {
-		for (int x = centerX - radius; x <= centerX + radius; ++x) {
-			int dx = x - centerX;
-			int dy = y - centerY;
-			if (dx * dx + dy * dy <= r2) {
-				placeElement(x, y, type);
+	chunkSpanCounts.assign(lastIndex - firstIndex + 2, 0);
+	for (const ChunkSpan& piece : chunkSpans) {
+		++chunkSpanCounts[directoryIndex(piece) - firstIndex + 1];
+	}
+	for (size_t bucket = 1; bucket < chunkSpanCounts.size(); ++bucket) {
+		chunkSpanCounts[bucket] += chunkSpanCounts[bucket - 1];
+	}
+	sortedChunkSpans.resize(chunkSpans.size());
+	for (const ChunkSpan& piece : chunkSpans) {
+		sortedChunkSpans[chunkSpanCounts[directoryIndex(piece) - firstIndex]++] = piece;
+	}
+	chunkSpans.swap(sortedChunkSpans);
+}
+
+// Chunks come out in directory order, so the changed ones are sorted by row
+template<typename TypeAt>
+std::vector<SDL_Point> CellularMatrix::placeChunkSpans(TypeAt typeAt) {
+	std::vector<SDL_Point> changedChunks;
+	size_t i = 0;
+	while (i < chunkSpans.size()) {
+		int chunkX = chunkSpans[i].chunkX;
+		int chunkY = chunkSpans[i].chunkY;
+		size_t groupEnd = i;
+		while (groupEnd < chunkSpans.size() && chunkSpans[groupEnd].chunkX == chunkX && chunkSpans[groupEnd].chunkY == chunkY) {
+			++groupEnd;
+		}
+
+		// An unmaterialized tile reads as all EMPTY, so erasing in it is a no-op;
+		// the first cell that changes it materializes the tile for the whole
+		// group. A fresh tile only gets EMPTY cells where nothing was written,
+		// after the group is placed. WALL is the ghost border and never placed;
+		// NO_CELL leaves the cell as it is.
+		Chunk* chunk = chunkAt(chunkX, chunkY);
+		bool fresh = false;
+		bool changed = false;
+		for (; i < groupEnd; ++i) {
+			const CellSpan& span = chunkSpans[i].span;
+			int localY = getLocal(span.y);
+			for (int x = span.x0; x <= span.x1; ++x) {
+				ElementType type = typeAt(x, span.y);
+				if (type == WALL || type == RegionSnapshot::NO_CELL) continue;
+				if (!chunk) {
+					if (type == EMPTY) continue;
+					chunk = &materializeChunk(chunkX, chunkY, false);
+					fresh = true;
+				}
+				Element*& cell = chunk->cellAt(getLocal(x), localY);
+				if (cell ? cell->getType() == type : type == EMPTY) continue;
+				Element* newElement = ElementFactory::createElementFromType(type, x, span.y);
+				delete cell;
+				cell = newElement;
+				chunk->setCellEmpty(getLocal(x), localY, type == EMPTY);
+				changed = true;
+			}
+		}
+		i = groupEnd;
+
+		if (fresh) {
+			int worldX = chunk->getWorldX();
+			int worldY = chunk->getWorldY();
+			Element** cells = chunk->getCells();
+			for (int index = 0; index < Chunk::CELL_COUNT; ++index) {
+				if (!cells[index]) {
+					cells[index] = new Empty(worldX + Chunk::localXOf(index), worldY + Chunk::localYOf(index));
+					chunk->setCellEmpty(Chunk::localXOf(index), Chunk::localYOf(index), true);
+				}
 			}
 		}
+
+		if (changed) {
+			chunk->markTextureDirty();
+			activateChunkAndNeighbors(chunk);
+			changedChunks.push_back({chunkX, chunkY});
+		}
 	}
+	return changedChunks;
 }
 
-// void CellularMatrix::heatElementsInArea(int centerX, int centerY, int radius) {
-// 	int r2 = radius * radius;
-// 	for (int y = centerY - radius; y <= centerY + radius; ++y) {
-// 		for (int x = centerX - radius; x <= centerX + radius; ++x) {
-// 			int dx = x - centerX;
-// 			int dy = y - centerY;
-// 			if (dx * dx + dy * dy <= r2) {
-// 				if (isInBounds(x, y)) {
-// 					matrix[y][x]->setTemperature(10000);
-// 					activateChunk(x, y);
-// 				}
-// 			}
-// 		}
-// 	}
-// }
+std::vector<SDL_Point> CellularMatrix::fillRect(int x, int y, int w, int h, ElementType type) {
+	return placeElementsInSpans(rectSpans(x, y, w, h), type);
+}
 
-void CellularMatrix::swapElements(int x1, int y1, int x2, int y2) {
-	std::swap(matrix[y1][x1], matrix[y2][x2]);
-	matrix[y1][x1]->setPosition(x1, y1);
-	matrix[y2][x2]->setPosition(x2, y2);
+std::vector<SDL_Point> CellularMatrix::clearRegion(int x, int y, int w, int h) {
+	return fillRect(x, y, w, h, EMPTY);
+}
 
-	// Mark both as updated for this frame to prevent double-update
-	matrix[y1][x1]->setAsUpdated();
-	matrix[y2][x2]->setAsUpdated();
+std::vector<SDL_Point> CellularMatrix::fillPolygon(const std::vector<SDL_Point>& vertices, ElementType type) {
+	if (vertices.size() < 3) return {};
 
-	int chunk1X = getChunkX(x1), chunk1Y = getChunkY(y1);
-	int chunk2X = getChunkX(x2), chunk2Y = getChunkY(y2);
-	
-	if (isValidChunk(chunk1X, chunk1Y)) {
-		chunks[chunk1Y][chunk1X].activate();
-		activateNeighboringChunks(x1, y1);
+	int minY = vertices[0].y, maxY = vertices[0].y;
+	for (const SDL_Point& v : vertices) {
+		minY = std::min(minY, v.y);
+		maxY = std::max(maxY, v.y);
 	}
-	if (chunk1X == chunk2X && chunk1Y == chunk2Y) return;
-	if (isValidChunk(chunk2X, chunk2Y)) {
-		chunks[chunk2Y][chunk2X].activate();
-		activateNeighboringChunks(x2, y2);
+	minY = std::max(minY, 0);
+	maxY = std::min(maxY, height - 1);
+
+	// Even-odd scanline fill, sampling cell centers
+	std::vector<CellSpan> spans;
+	std::vector<double> crossings;
+	for (int y = minY; y <= maxY; ++y) {
+		double sampleY = y + 0.5;
+		crossings.clear();
+		for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+			const SDL_Point& a = vertices[i];
+			const SDL_Point& b = vertices[j];
+			if ((a.y <= sampleY) != (b.y <= sampleY)) {
+				crossings.push_back(a.x + (sampleY - a.y) * (b.x - a.x) / (b.y - a.y));
+			}
+		}
+		std::sort(crossings.begin(), crossings.end());
+		for (size_t k = 0; k + 1 < crossings.size(); k += 2) {
+			int x0 = static_cast<int>(std::ceil(crossings[k] - 0.5));
+			int x1 = static_cast<int>(std::floor(crossings[k + 1] - 0.5));
+			if (x0 <= x1) {
+				spans.push_back({y, x0, x1});
+			}
+		}
 	}
+	return placeElementsInSpans(spans, type);
 }
 
-//-------------------------------------------
-// Chunk Management
-//-------------------------------------------
-void CellularMatrix::activateChunk(int x, int y) {
-	int chunkX = getChunkX(x);
-	int chunkY = getChunkY(y);
-	if (isValidChunk(chunkX, chunkY)) {
-		chunks[chunkY][chunkX].activate();
+std::vector<SDL_Point> CellularMatrix::floodFill(int x, int y, ElementType type) {
+	if (!isInBounds(x, y)) return {};
+	ElementType target = cellAt(x, y)->getType();
+	if (target == type) return {};
+
+	// Scanline flood fill over the 4-connected region of the target type. Visited
+	// cells are kept per chunk the fill reaches, so a small fill costs the same in
+	// any size of world.
+	std::unordered_map<int, std::bitset<Chunk::CELL_COUNT>> visited;
+	auto visitedBit = [&](int cx, int cy) {
+		return visited[getChunkY(cy) * chunksX + getChunkX(cx)][Chunk::cellIndex(getLocal(cx), getLocal(cy))];
+	};
+	std::vector<CellSpan> spans;
+	std::vector<SDL_Point> seeds{{x, y}};
+	auto matches = [&](int cx, int cy) {
+		return cellAt(cx, cy)->getType() == target && !visitedBit(cx, cy);
+	};
+	while (!seeds.empty()) {
+		SDL_Point seed = seeds.back();
+		seeds.pop_back();
+		if (!matches(seed.x, seed.y)) continue;
+
+		int x0 = seed.x, x1 = seed.x;
+		while (x0 > 0 && matches(x0 - 1, seed.y)) --x0;
+		while (x1 < width - 1 && matches(x1 + 1, seed.y)) ++x1;
+		for (int cx = x0; cx <= x1; ++cx) {
+			visitedBit(cx, seed.y) = true;
+		}
+		spans.push_back({seed.y, x0, x1});
+
+		// One seed per run of matching cells in the rows above and below
+		for (int ny : {seed.y - 1, seed.y + 1}) {
+			if (ny < 0 || ny >= height) continue;
+			bool inRun = false;
+			for (int cx = x0; cx <= x1; ++cx) {
+				bool match = matches(cx, ny);
+				if (match && !inRun) {
+					seeds.push_back({cx, ny});
+				}
+				inRun = match;
+			}
+		}
 	}
-	activateNeighboringChunks(x, y);
+	return placeElementsInSpans(spans, type);
 }
 
-void CellularMatrix::activateNeighboringChunks(int x, int y) {
-	bool onLeftEdge   = (x % g_CHUNK_SIZE) == 0;
-	bool onRightEdge  = (x % g_CHUNK_SIZE) == g_CHUNK_SIZE - 1;
-	bool onTopEdge    = (y % g_CHUNK_SIZE) == 0;
-	bool onBottomEdge = (y % g_CHUNK_SIZE) == g_CHUNK_SIZE - 1;
+CellularMatrix::RegionSnapshot CellularMatrix::copyRegion(int x, int y, int w, int h) const {
+	RegionSnapshot region;
+	region.width = std::max(w, 0);
+	region.height = std::max(h, 0);
+	region.types.resize(static_cast<size_t>(region.width) * region.height, RegionSnapshot::NO_CELL);
+	for (int row = 0; row < region.height; ++row) {
+		for (int col = 0; col < region.width; ++col) {
+			if (isInBounds(x + col, y + row)) {
+				region.types[static_cast<size_t>(row) * region.width + col] = cellAt(x + col, y + row)->getType();
+			}
+		}
+	}
+	return region;
+}
 
-	int chunkX = getChunkX(x);
-	int chunkY = getChunkY(y);
+std::vector<SDL_Point> CellularMatrix::pasteRegion(const RegionSnapshot& region, int x, int y) {
+	// One pass over the covered chunks, each cell taking its type from the snapshot
+	splitSpansByChunk(rectSpans(x, y, region.width, region.height));
+	return placeChunkSpans([&region, x, y](int cellX, int cellY) {
+		return region.types[static_cast<size_t>(cellY - y) * region.width + (cellX - x)];
+	});
+}
 
-	if (onLeftEdge && isValidChunk(chunkX - 1, chunkY)) {
-		chunks[chunkY][chunkX - 1].activate();
+std::vector<CellSpan> CellularMatrix::rectSpans(int x, int y, int w, int h) {
+	std::vector<CellSpan> spans;
+	if (w <= 0 || h <= 0) return spans;
+	spans.reserve(h);
+	for (int row = y; row < y + h; ++row) {
+		spans.push_back({row, x, x + w - 1});
 	}
-	if (onRightEdge && isValidChunk(chunkX + 1, chunkY)) {
-		chunks[chunkY][chunkX + 1].activate();
+	return spans;
+}
+
+// Wakes every cell of the chunk and of its direct neighbors, whose border cells may react
+void CellularMatrix::activateChunkAndNeighbors(Chunk* chunk) {
+	chunk->wakeAllCells();
+	chunk->activate();
+	const int neighbors[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+	for (const auto& offset : neighbors) {
+		int chunkX = chunk->getChunkX() + offset[0];
+		int chunkY = chunk->getChunkY() + offset[1];
+		if (isValidChunk(chunkX, chunkY)) {
+			if (Chunk* neighbor = chunkAt(chunkX, chunkY)) {
+				neighbor->wakeAllCells();
+				neighbor->activate();
+			}
+		}
 	}
-	if (onTopEdge && isValidChunk(chunkX, chunkY - 1)) {
-		chunks[chunkY - 1][chunkX].activate();
+}
+
+void CellularMatrix::ignite(int x, int y) {
+	if (!isInBounds(x, y)) return;
+	ElementType type = cellAt(x, y)->getType();
+	if (type != FIRE && ELEMENT_PROPERTIES[type].flammability <= 0.0f) return;
+	if (combustion.track(x, y, type) && type != FIRE) {
+		placeElement(x, y, FIRE);
 	}
-	if (onBottomEdge && isValidChunk(chunkX, chunkY + 1)) {
-		chunks[chunkY + 1][chunkX].activate();
+}
+
+void CellularMatrix::igniteSpans(const std::vector<CellSpan>& spans) {
+	// Only what actually caught is turned into fire, in one batch
+	litSpans.clear();
+	for (const CellSpan& span : spans) {
+		for (int x = span.x0; x <= span.x1; ++x) {
+			if (!isInBounds(x, span.y)) continue;
+			ElementType type = cellAt(x, span.y)->getType();
+			if (type == FIRE || ELEMENT_PROPERTIES[type].flammability <= 0.0f) continue;
+			if (!combustion.track(x, span.y, type)) continue;
+			if (!litSpans.empty() && litSpans.back().y == span.y && litSpans.back().x1 == x - 1) {
+				litSpans.back().x1 = x;
+			} else {
+				litSpans.push_back({span.y, x, x});
+			}
+		}
 	}
+	placeElementsInSpans(litSpans, FIRE);
 }
 
-bool CellularMatrix::isValidChunk(int chunkX, int chunkY) const {
-	return chunkX >= 0 && chunkX < g_CHUNKS_X && chunkY >= 0 && chunkY < g_CHUNKS_Y;
+void CellularMatrix::swapElements(int x1, int y1, int x2, int y2) {
+	// Moving into an unmaterialized tile materializes it
+	Element*& cell1 = materializedCellAt(x1, y1);
+	Element*& cell2 = materializedCellAt(x2, y2);
+	std::swap(cell1, cell2);
+	cell1->setPosition(x1, y1);
+	cell2->setPosition(x2, y2);
+	syncEmptyBit(x1, y1);
+	syncEmptyBit(x2, y2);
+	temperatureField.swapCells(x1, y1, x2, y2);
+
+	// Mark both as updated for this frame to prevent double-update
+	cell1->setAsUpdated();
+	cell2->setAsUpdated();
+
+	Chunk* chunk1 = chunkContaining(x1, y1);
+	Chunk* chunk2 = chunkContaining(x2, y2);
+
+	chunk1->recordSwap();
+	chunk1->markTextureDirty();
+	chunk2->markTextureDirty();
+
+	// Both cells and everything around them may now be able to move
+	wakeNeighborhood(x1, y1);
+	wakeNeighborhood(x2, y2);
 }
 
-int CellularMatrix::getActiveChunkCount() const {
+void CellularMatrix::shiftColumnDown(int x, int topY, int bottomY, int distance) {
+	if (distance <= 0 || topY > bottomY) return;
+
+	// Lift out the cells below the run (materializing their chunks first), move
+	// the run down and drop the lifted cells into the vacated top
+	displacedCells.clear();
+	for (int y = bottomY + 1; y <= bottomY + distance; ++y) {
+		displacedCells.push_back(materializedCellAt(x, y));
+	}
+	for (int y = bottomY; y >= topY; --y) {
+		Element*& cell = materializedCellAt(x, y + distance);
+		cell = cellAt(x, y);
+		cell->setPosition(x, y + distance);
+		cell->setAsUpdated();
+		syncEmptyBit(x, y + distance);
+	}
+	for (int i = 0; i < distance; ++i) {
+		Element*& cell = materializedCellAt(x, topY + i);
+		cell = displacedCells[i];
+		cell->setPosition(x, topY + i);
+		cell->setAsUpdated();
+		syncEmptyBit(x, topY + i);
+	}
+	temperatureField.shiftColumnDown(x, topY, bottomY, distance);
+
+	// One swap per chunk on the heatmap, since the run moves as one
+	for (int chunkY = getChunkY(topY); chunkY <= getChunkY(bottomY + distance); ++chunkY) {
+		Chunk* chunk = chunkAt(getChunkX(x), chunkY);
+		chunk->recordSwap();
+		chunk->markTextureDirty();
+	}
+
+	// Every cell of the span changed, so the column and both sides may now move
+	for (int y = topY - 1; y <= bottomY + distance + 1; ++y) {
+		activateChunk(x - 1, y);
+		activateChunk(x, y);
+		activateChunk(x + 1, y);
+	}
+}
+
+//-------------------------------------------
+// Occupancy Queries
+//-------------------------------------------
+namespace {
+	int countTrailingOnes(uint64_t bits) { return ~bits ? __builtin_ctzll(~bits) : 64; }
+	int countLeadingOnes(uint64_t bits) { return ~bits ? __builtin_clzll(~bits) : 64; }
+}
+
+int CellularMatrix::countEmptyInRow(int x, int y, int dir, int maxCount) const {
+	int localY = getLocal(y);
+	int count = 0;
+	while (count < maxCount) {
+		// Cells left in this chunk in the direction of travel; unmaterialized
+		// tiles are all EMPTY, and the ghost ring has no EMPTY cells
+		int localX = getLocal(x);
+		int remaining = dir > 0 ? g_CHUNK_SIZE - localX : localX + 1;
+		if (const Chunk* chunk = chunkContaining(x, y)) {
+			uint64_t row = chunk->getEmptyRow(localY);
+			int run = dir > 0 ? countTrailingOnes(row >> localX)
+							  : countLeadingOnes(row << (63 - localX));
+			if (run < remaining) return std::min(count + run, maxCount);
+		}
+		count += remaining;
+		x += dir * remaining;
+	}
+	return maxCount;
+}
+
+int CellularMatrix::countEmptyBelow(int x, int y, int maxCount) const {
+	int localX = getLocal(x);
+	int count = 0;
+	while (count < maxCount) {
+		int localY = getLocal(y);
+		int remaining = g_CHUNK_SIZE - localY;
+		if (const Chunk* chunk = chunkContaining(x, y)) {
+			int run = countTrailingOnes(chunk->getEmptyColumn(localX) >> localY);
+			if (run < remaining) return std::min(count + run, maxCount);
+		}
+		count += remaining;
+		y += remaining;
+	}
+	return maxCount;
+}
+
+int CellularMatrix::countEmptyInRect(int x, int y, int w, int h) const {
 	int count = 0;
-	for (int chunkY = 0; chunkY < g_CHUNKS_Y; ++chunkY) {
-		for (int chunkX = 0; chunkX < g_CHUNKS_X; ++chunkX) {
-			if (chunks[chunkY][chunkX].isActive()) {
-				count++;
+	for (int row = y; row < y + h; ++row) {
+		int localY = getLocal(row);
+		for (int column = x; column < x + w;) {
+			int localX = getLocal(column);
+			int span = std::min(g_CHUNK_SIZE - localX, x + w - column);
+			if (const Chunk* chunk = chunkContaining(column, row)) {
+				uint64_t bits = chunk->getEmptyRow(localY) >> localX;
+				count += __builtin_popcountll(span < 64 ? bits & ((uint64_t(1) << span) - 1) : bits);
+			} else {
+				count += span;
 			}
+			column += span;
+		}
+	}
+	return count;
+}
+
+bool CellularMatrix::absorbGas(int x, int y) {
+	if (!gasFieldEnabled) return false;
+	gasField.add(cellAt(x, y)->getType(), x, y);
+	destroyElement(x, y);
+	return true;
+}
+
+//-------------------------------------------
+// Chunk Management
+//-------------------------------------------
+int CellularMatrix::getActiveChunkCount() const {
+	int count = 0;
+	for (const Chunk* chunk : liveChunks) {
+		if (chunk->isActive()) {
+			count++;
 		}
 	}
 	return count;
@@ -222,75 +657,277 @@ void CellularMatrix::switchDebugMode() {
 	debugMode = !debugMode;
 }
 
+void CellularMatrix::cycleHeatmapMode() {
+	heatmapMode = static_cast<HeatmapMode>((heatmapMode + 1) % HEATMAP_MODE_COUNT);
+}
+
 //-------------------------------------------
 // Simulation Update
 //-------------------------------------------
+void CellularMatrix::scheduleWake(int x, int y, uint64_t delay) {
+	timers.schedule(tick + std::max<uint64_t>(delay, 1), x, y);
+}
+
 void CellularMatrix::update() {
-	static int columnOrder[Matrix::WIDTH];
-	for (int x = 0; x < Matrix::WIDTH; ++x) columnOrder[x] = x;
+	// Wake-ups that fall on this tick
+	timers.advance(dueWakes);
+	for (const TimerWheel::Event& wake : dueWakes) {
+		activateChunk(wake.x, wake.y);
+	}
 
-	for (int y = Matrix::HEIGHT - 1; y >= 0; --y) {
-		std::shuffle(columnOrder, columnOrder + Matrix::WIDTH, rng);
+	// Reaction wakes are dropped once their element moved or redrew its tick
+	reactionTimers.advance(dueWakes);
+	for (const TimerWheel::Event& wake : dueWakes) {
+		if (getElement(wake.x, wake.y)->getReactionTick() == wake.tick) {
+			activateChunk(wake.x, wake.y);
+		}
+	}
 
-		for (int x : columnOrder) {
-			int chunkX = getChunkX(x);
-			int chunkY = getChunkY(y);
-			if (chunks[chunkY][chunkX].isActive()) {
-				matrix[y][x]->update(*this);
-			}
+	if (liquidLeveler.isDue(tick)) {
+		levelLiquids();
+	}
+
+	// Bottom-up over chunk rows; rows without active chunks are skipped entirely
+	for (int chunkY = chunksY - 1; chunkY >= 0; --chunkY) {
+		if (rowLiveCount[chunkY] > 0) {
+			updateChunkRow(chunkY);
 		}
 	}
-	for (auto& row : chunks) {
-		for (auto& chunk : row) {
-			chunk.updateActivityState();
+
+	combustion.update(*this);
+
+	// Chunks that just went idle with nothing left in them are released
+	for (size_t i = 0; i < liveChunks.size();) {
+		Chunk* chunk = liveChunks[i];
+		if (chunk->updateActivityState() && chunk->isAllEmpty()) {
+			releaseChunk(chunk); // moves the last live chunk into slot i
+		} else {
+			++i;
 		}
 	}
+	temperatureField.update(*this);
+	gasField.update(*this);
 	ParticleManager::updateParticles();
 	Element::s_Step = !Element::s_Step;
+	++tick;
 }
 
-void CellularMatrix::updateChunk(int chunkX, int chunkY) {
-	int startX = chunkX * g_CHUNK_SIZE;
-	int startY = chunkY * g_CHUNK_SIZE;
-	int endX = std::min(startX + g_CHUNK_SIZE, Matrix::WIDTH);
-	int endY = std::min(startY + g_CHUNK_SIZE, Matrix::HEIGHT);
+// Levels the liquid bodies that have awake cells; settled ones are not visited.
+// A pass runs over several ticks and only takes its seeds when it starts.
+void CellularMatrix::levelLiquids() {
+	if (liquidLeveler.isPassRunning()) {
+		liquidLeveler.step(*this);
+		return;
+	}
+	levelSeeds.clear();
+	for (Chunk* chunk : liveChunks) {
+		if (!chunk->isActive() || !chunk->hasAwakeCells()) continue;
+		for (int index = 0; index < Chunk::CELL_COUNT; ++index) {
+			if (chunk->isCellAwake(index) && liquidLeveler.isLiquid(chunk->cells[index])) {
+				levelSeeds.push_back({chunk->getWorldX() + Chunk::localXOf(index),
+									  chunk->getWorldY() + Chunk::localYOf(index)});
+			}
+		}
+	}
+	liquidLeveler.startPass(levelSeeds, tick);
+	liquidLeveler.step(*this);
+}
 
-	// Create column order for this chunk
-	std::vector<int> columnOrder;
-	for (int x = startX; x < endX; ++x) {
-		columnOrder.push_back(x);
+void CellularMatrix::updateChunkRow(int chunkY) {
+	activeChunkColumns.clear();
+	for (int chunkX = 0; chunkX < chunksX; ++chunkX) {
+		Chunk* chunk = chunkAt(chunkX, chunkY);
+		if (chunk && chunk->isActive() && chunk->hasAwakeCells()) {
+			// Elements may recolor themselves while updating, even without moving
+			chunk->markTextureDirty();
+			activeChunkColumns.push_back(chunkX);
+		}
 	}
-	
-	// Process from bottom to top
+	if (activeChunkColumns.empty()) return;
+
+	// Columns of all active chunks in this row, shuffled per cell row to prevent bias
+	columnOrder.clear();
+	for (int chunkX : activeChunkColumns) {
+		int startX = chunkX * g_CHUNK_SIZE;
+		int endX = std::min(startX + g_CHUNK_SIZE, width);
+		for (int x = startX; x < endX; ++x) {
+			columnOrder.push_back(x);
+		}
+	}
+
+	int startY = chunkY * g_CHUNK_SIZE;
+	int endY = std::min(startY + g_CHUNK_SIZE, height);
 	for (int y = endY - 1; y >= startY; --y) {
 		std::shuffle(columnOrder.begin(), columnOrder.end(), rng);
-		
+
 		for (int x : columnOrder) {
-			matrix[y][x]->update(*this);
+			Chunk* chunk = chunkAt(getChunkX(x), chunkY);
+			int index = Chunk::cellIndex(getLocal(x), getLocal(y));
+			if (!chunk->isCellAwake(index)) continue;
+
+			// An element that moved here earlier in this tick stays awake for the next one
+			Element* element = chunk->cells[index];
+			if (element->getHasUpdated()) continue;
+
+			// Asleep again unless the update moves something nearby or the
+			// element asks to stay awake (activateChunk on itself)
+			chunk->sleepCell(index);
+			ElementType type = element->getType();
+			if (type != EMPTY) {
+				chunk->recordUpdate();
+			}
+			// Heat sources hold their cell at their temperature while awake
+			if (float source = ELEMENT_PROPERTIES[type].sourceTemperature; source > 0.0f) {
+				temperatureField.setTemperature(x, y, source);
+			}
+			// Neighbor reactions; an element that reacted into something else is done
+			if (REACTION_LOOKUP.hasReactions(type) && applyReactions(x, y, *element)) {
+				continue;
+			}
+			// Dense jump table by type; inert cells (EMPTY, STONE, ...) have no kernel
+			if (UpdateKernel kernel = ElementFactory::getUpdateKernel(type)) {
+				kernel(*element, *this);
+			}
+			// An element left asleep with a reaction pending is woken when it is
+			// due; one that moved or was woken is updated again next tick anyway
+			if (REACTION_LOOKUP.hasReactions(type) && chunk->cells[index] == element && !chunk->isCellAwake(index)) {
+				scheduleReaction(x, y, *element);
+			}
 		}
 	}
 }
 
+bool CellularMatrix::applyReactions(int x, int y, Element& element) {
+	static constexpr int NEIGHBORS[8][2] = {
+		{-1, -1}, {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}
+	};
+
+	// Neighbors the element reacts with, and the chance that any of them reacts
+	// on a tick; cells one step outside the world read as WALL, which nothing
+	// reacts with
+	ElementType type = element.getType();
+	int reactants[8];
+	float chances[8];
+	int reactantCount = 0;
+	float totalChance = 0.0f;
+	float noneChance = 1.0f;
+	for (int i = 0; i < 8; ++i) {
+		ElementType neighborType = cellAt(x + NEIGHBORS[i][0], y + NEIGHBORS[i][1])->getType();
+		if (!REACTION_LOOKUP.reactsWith(type, neighborType)) continue;
+		float chance = REACTIONS[REACTION_LOOKUP.index[type][neighborType]].chance;
+		reactants[reactantCount] = i;
+		chances[reactantCount++] = chance;
+		totalChance += chance;
+		noneChance *= 1.0f - chance;
+	}
+	if (reactantCount == 0) {
+		element.setReaction(Element::NO_TICK, 0.0f);
+		return false;
+	}
+
+	// Rather than rolling every tick and staying awake meanwhile, the failed
+	// rolls before the first success are drawn once, as gas lifetimes are, and
+	// again only when the neighbors change the chance; scheduleReaction wakes
+	// the cell when they are over
+	float chance = 1.0f - noneChance;
+	if (element.getReactionTick() == Element::NO_TICK || element.getReactionChance() != chance) {
+		int failures = ElementRNG::getFailuresBeforeChance(chance);
+		element.setReaction(failures == INT_MAX ? Element::NO_TICK - 1 : tick + failures, chance);
+	}
+	if (tick < element.getReactionTick()) return false;
+	element.setReaction(Element::NO_TICK, 0.0f);
+
+	// One of the neighbors reacts, in proportion to its chance
+	float pick = ElementRNG::getRandomFloat(0.0f, totalChance);
+	int reactant = reactants[reactantCount - 1];
+	for (int i = 0; i < reactantCount; ++i) {
+		pick -= chances[i];
+		if (pick < 0.0f) {
+			reactant = reactants[i];
+			break;
+		}
+	}
+	int neighborX = x + NEIGHBORS[reactant][0];
+	int neighborY = y + NEIGHBORS[reactant][1];
+	ElementType neighborType = cellAt(neighborX, neighborY)->getType();
+	const Reaction& reaction = REACTIONS[REACTION_LOOKUP.index[type][neighborType]];
+
+	if (reaction.neighborProduct != neighborType) {
+		placeElement(neighborX, neighborY, reaction.neighborProduct);
+	}
+	if (reaction.byproduct != EMPTY && isEmpty(x, y - 1)) {
+		placeElement(x, y - 1, reaction.byproduct);
+	}
+	if (reaction.selfProduct != type) {
+		placeElement(x, y, reaction.selfProduct);
+		return true;
+	}
+	return false;
+}
+
+void CellularMatrix::scheduleReaction(int x, int y, Element& element) {
+	uint64_t due = element.getReactionTick();
+	if (due >= Element::NO_TICK - 1 || due <= tick || element.isReactionWakeScheduled()) return;
+	reactionTimers.schedule(due, x, y);
+	element.setReactionWakeScheduled();
+}
+
 //-------------------------------------------
 // Rendering
 //-------------------------------------------
-void CellularMatrix::updateTexture() {
-	// Convert element colors to pixel format
-	for (int y = Matrix::HEIGHT - 1; y >= 0; --y) {
-		for (int x = 0; x < Matrix::WIDTH; ++x) {
-			SDL_Color color = matrix[y][x]->getColor();
+void CellularMatrix::markTextureDirty(int x, int y) {
+	if (Chunk* chunk = chunkContaining(x, y)) {
+		chunk->markTextureDirty();
+	}
+}
+
+void CellularMatrix::updateTexture(int viewX, int viewY) {
+	int firstChunkX = std::max(0, getChunkX(viewX));
+	int firstChunkY = std::max(0, getChunkY(viewY));
+	int lastChunkX = std::min(chunksX - 1, getChunkX(viewX + viewWidth - 1));
+	int lastChunkY = std::min(chunksY - 1, getChunkY(viewY + viewHeight - 1));
 
-			pixels[y * Matrix::WIDTH + x] = (color.r << 24) | (color.g << 16) | 
-								   (color.b << 8) | color.a;
+	if (fullConversionPending || viewX != convertedViewX || viewY != convertedViewY) {
+		// Reconvert every tile in view; cells outside the world stay transparent
+		std::fill(basePixels.begin(), basePixels.end(), 0);
+		for (int chunkY = firstChunkY; chunkY <= lastChunkY; ++chunkY) {
+			for (int chunkX = firstChunkX; chunkX <= lastChunkX; ++chunkX) {
+				convertTile(chunkX, chunkY, viewX, viewY);
+			}
+		}
+		fullConversionPending = false;
+		convertedViewX = viewX;
+		convertedViewY = viewY;
+	} else {
+		// Only tiles that were released or touched since the last conversion
+		for (const SDL_Point& tile : releasedTiles) {
+			if (tile.x >= firstChunkX && tile.x <= lastChunkX && tile.y >= firstChunkY && tile.y <= lastChunkY) {
+				convertTile(tile.x, tile.y, viewX, viewY);
+			}
 		}
+		for (Chunk* chunk : liveChunks) {
+			int chunkX = chunk->getChunkX();
+			int chunkY = chunk->getChunkY();
+			if (chunk->isTextureDirty() && chunkX >= firstChunkX && chunkX <= lastChunkX &&
+				chunkY >= firstChunkY && chunkY <= lastChunkY) {
+				convertTile(chunkX, chunkY, viewX, viewY);
+			}
+		}
+	}
+	releasedTiles.clear();
+	for (Chunk* chunk : liveChunks) {
+		chunk->clearTextureDirty();
 	}
+	pixels = basePixels;
+	gasField.render(*this, pixels, viewX, viewY, viewWidth, viewHeight);
 
 	if (debugMode) {
-		for (int chunkY = g_CHUNKS_Y - 1; chunkY >= 0; --chunkY) {
-			for (int chunkX = 0; chunkX < g_CHUNKS_X; ++chunkX) {
-				Chunk chunk = chunks[chunkY][chunkX];
-				if (chunk.isActive()) {
-					g_Renderer->drawScreenSpaceRect(chunk.getWorldX(), chunk.getWorldY(), g_CHUNK_SIZE, g_CHUNK_SIZE, 1);
+		// Only chunks overlapping the view are outlined
+		for (int chunkY = lastChunkY; chunkY >= firstChunkY; --chunkY) {
+			for (int chunkX = firstChunkX; chunkX <= lastChunkX; ++chunkX) {
+				const Chunk* chunk = chunkAt(chunkX, chunkY);
+				if (chunk && chunk->isActive()) {
+					g_Renderer->drawScreenSpaceRect(chunk->getWorldX(), chunk->getWorldY(), g_CHUNK_SIZE, g_CHUNK_SIZE, 1);
 				}
 			}
 		}
@@ -300,11 +937,11 @@ void CellularMatrix::updateTexture() {
 		Particle& p = *ParticleManager::getParticle(i);
 		for (int dy = 0; dy < p.height; ++dy) {
 			for (int dx = 0; dx < p.width; ++dx) {
-				int px = p.x + dx;
-				int py = p.y + dy;
+				int px = p.x + dx - viewX;
+				int py = p.y + dy - viewY;
 
-				if (px >= 0 && px < Matrix::WIDTH && py >= 0 && py < Matrix::HEIGHT) {
-					int index = py * Matrix::WIDTH + px;
+				if (px >= 0 && px < viewWidth && py >= 0 && py < viewHeight) {
+					int index = py * viewWidth + px;
 
 					// Extract background color
 					Uint32 bg = pixels[index];
@@ -335,9 +972,81 @@ void CellularMatrix::updateTexture() {
 	}
 
 	// Update and render texture
-	SDL_UpdateTexture(renderTexture, NULL, pixels.data(), Matrix::WIDTH * sizeof(Uint32));
+	SDL_UpdateTexture(renderTexture, NULL, pixels.data(), viewWidth * sizeof(Uint32));
+}
+
+void CellularMatrix::convertTile(int chunkX, int chunkY, int viewX, int viewY) {
+	int worldX = chunkX * g_CHUNK_SIZE;
+	int worldY = chunkY * g_CHUNK_SIZE;
+	const Chunk* chunk = chunkAt(chunkX, chunkY);
+	SDL_Color emptyColor = emptyCell.getColor();
+	Uint32 emptyPixel = (emptyColor.r << 24) | (emptyColor.g << 16) | (emptyColor.b << 8) | emptyColor.a;
+
+	// Linear walk over the tile's cells, clipped to the view and the world
+	for (int i = 0; i < Chunk::CELL_COUNT; ++i) {
+		int x = worldX + Chunk::localXOf(i);
+		int y = worldY + Chunk::localYOf(i);
+		int px = x - viewX;
+		int py = y - viewY;
+		if (px < 0 || px >= viewWidth || py < 0 || py >= viewHeight || x >= width || y >= height) {
+			continue;
+		}
+
+		Uint32 pixel = emptyPixel;
+		if (chunk) {
+			SDL_Color color = chunk->cells[i]->getColor();
+			pixel = (color.r << 24) | (color.g << 16) | (color.b << 8) | color.a;
+		}
+		basePixels[static_cast<size_t>(py) * viewWidth + px] = pixel;
+	}
 }
 
 SDL_Texture* CellularMatrix::getTexture() const {
 	return renderTexture;
-}
\ No newline at end of file
+}
+
+void CellularMatrix::updateHeatmapTexture(int viewX, int viewY) {
+	if (heatmapMode == HEATMAP_OFF || !heatmapTexture) return;
+
+	// Normalize against a fully busy chunk: every cell updating or swapping once per tick
+	const float fullScale = static_cast<float>(g_CHUNK_SIZE * g_CHUNK_SIZE);
+	int firstChunkX = viewX / g_CHUNK_SIZE;
+	int firstChunkY = viewY / g_CHUNK_SIZE;
+
+	for (int ty = 0; ty < heatmapHeight; ++ty) {
+		for (int tx = 0; tx < heatmapWidth; ++tx) {
+			int chunkX = firstChunkX + tx;
+			int chunkY = firstChunkY + ty;
+			Uint32& texel = heatmapPixels[ty * heatmapWidth + tx];
+			const Chunk* chunk = isValidChunk(chunkX, chunkY) ? chunkAt(chunkX, chunkY) : nullptr;
+			if (!chunk) {
+				texel = 0;
+				continue;
+			}
+
+			float cost = (heatmapMode == HEATMAP_UPDATES) ? chunk->getSmoothedUpdates()
+														  : chunk->getSmoothedSwaps();
+			float t = std::clamp(cost / fullScale, 0.0f, 1.0f);
+
+			// Blue (cold) -> red (hot) ramp, transparent where nothing happens
+			Uint8 r = static_cast<Uint8>(255 * t);
+			Uint8 g = static_cast<Uint8>(64 * (1.0f - t));
+			Uint8 b = static_cast<Uint8>(255 * (1.0f - t));
+			Uint8 a = cost > 0.01f ? static_cast<Uint8>(60 + 140 * t) : 0;
+
+			texel = (r << 24) | (g << 16) | (b << 8) | a;
+		}
+	}
+
+	SDL_UpdateTexture(heatmapTexture, NULL, heatmapPixels.data(), heatmapWidth * sizeof(Uint32));
+}
+
+SDL_Rect CellularMatrix::getHeatmapDstRect(int viewX, int viewY) const {
+	// Texel (0, 0) is the chunk containing the view origin, so shift by the origin's offset into it
+	return {
+		-(viewX % g_CHUNK_SIZE),
+		-(viewY % g_CHUNK_SIZE),
+		heatmapWidth * g_CHUNK_SIZE,
+		heatmapHeight * g_CHUNK_SIZE
+	};
+}
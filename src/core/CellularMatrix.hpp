@@ -4,15 +4,66 @@
 
 #include "src/core/IMatrix.hpp"
 #include "src/core/Chunk.hpp"
+#include "src/core/BrushStroke.hpp"
+#include "src/core/TimerWheel.hpp"
+#include "src/core/LiquidLeveler.hpp"
+#include "src/core/GasField.hpp"
+#include "src/core/TemperatureField.hpp"
+#include "src/core/CombustionSystem.hpp"
 #include "src/core/Globals.hpp"
 #include "src/elements/Element.hpp"
+#include "src/elements/types/Empty.hpp"
+#include "src/elements/types/Wall.hpp"
 #include "src/particles/ParticleManager.hpp"
 #include <SDL2/SDL.h>
 #include <vector>
 #include <random>
 
-class CellularMatrix : public IMatrix {
+/**
+ * @brief The simulated world.
+ *
+ * Cells are stored sparsely: the world is a directory of g_CHUNK_SIZE tiles and
+ * a Chunk is only materialized while its tile holds something other than EMPTY.
+ * Reads of unmaterialized tiles see EMPTY, writes materialize them, and chunks
+ * that settle fully empty are released at the end of the tick, so memory
+ * follows the content rather than the map area.
+ *
+ * The directory has a one-chunk ghost ring pointing at a shared wall chunk, and
+ * chunks cut off by the world edge are kept materialized with WALL cells
+ * beyond it, so element kernels can read any direct neighbor without bounds
+ * checks. The cells just outside the world read as WALL.
+ *
+ * The class is final and its hot accessors are defined inline below, so
+ * element kernels instantiated for CellularMatrix (see Element::update) call
+ * them directly instead of through IMatrix.
+ */
+class CellularMatrix final : public IMatrix {
 public:
+	/**
+	 * @brief What the per-chunk cost heatmap visualizes.
+	 */
+	enum HeatmapMode {
+		HEATMAP_OFF,
+		HEATMAP_UPDATES,  ///< Element updates dispatched per tick
+		HEATMAP_SWAPS,    ///< Element swaps per tick
+		HEATMAP_MODE_COUNT
+	};
+
+	/**
+	 * @brief Element types of a rectangular region, as captured by copyRegion.
+	 *
+	 * Cells of the region that were outside the world hold NO_CELL. Pasting
+	 * leaves the destination cells under NO_CELL and WALL entries unchanged,
+	 * since the ghost border is never placed inside the world.
+	 */
+	struct RegionSnapshot {
+		static constexpr ElementType NO_CELL = ELEMENT_TYPE_COUNT;
+
+		int width = 0;
+		int height = 0;
+		std::vector<ElementType> types; ///< Row-major, width * height entries
+	};
+
 	CellularMatrix(int width, int height);
 	~CellularMatrix();
 
@@ -24,38 +75,162 @@ public:
 	void destroyElement(int x, int y) override;
 	void swapElements(int x1, int y1, int x2, int y2) override;
 
-	// Rendering
-	void initializeTexture(SDL_Renderer* renderer);
-	void updateTexture();
+	// Moves the cells of column x in [topY, bottomY] down by distance in one
+	// shift; the cells they land on (normally EMPTY) end up above them
+	void shiftColumnDown(int x, int topY, int bottomY, int distance);
+
+	// Length of the run of EMPTY cells starting at (x, y), along the row in
+	// direction dir (+1 or -1) or down the column, capped at maxCount. Read from
+	// the chunk occupancy masks, a chunk at a time.
+	int countEmptyInRow(int x, int y, int dir, int maxCount) const;
+	int countEmptyBelow(int x, int y, int maxCount) const;
+	int countEmptyInRect(int x, int y, int w, int h) const;
+
+	// World dimensions
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	int getChunksX() const { return chunksX; }
+	int getChunksY() const { return chunksY; }
+	int getTotalChunkCount() const { return chunksX * chunksY; }
+	int getMaterializedChunkCount() const { return static_cast<int>(liveChunks.size()); }
+
+	// Rendering (textures cover a view-sized window into the world)
+	void initializeTexture(SDL_Renderer* renderer, int viewWidth, int viewHeight);
+	void updateTexture(int viewX, int viewY);
+	void markTextureDirty(int x, int y);
 	SDL_Texture* getTexture() const; // returns renderTexture
+	void updateHeatmapTexture(int viewX, int viewY);
+	SDL_Texture* getHeatmapTexture() const { return heatmapTexture; }
+	SDL_Rect getHeatmapDstRect(int viewX, int viewY) const;
 
 	// Element placement
 	void placeElement(int x, int y, ElementType type) override;
 	void placeElementsInArea(int centerX, int centerY, int radius, ElementType type);
-	void heatElementsInArea(int centerX, int centerY, int radius);
+	void placeElementsAlongStroke(int fromX, int fromY, int toX, int toY, int radius, ElementType type);
+
+	// Bulk region operations. Work is done one chunk at a time, and each returns
+	// the chunk coordinates it changed (sorted, no duplicates).
+	std::vector<SDL_Point> placeElementsInSpans(const std::vector<CellSpan>& spans, ElementType type);
+	std::vector<SDL_Point> fillRect(int x, int y, int w, int h, ElementType type);
+	std::vector<SDL_Point> fillPolygon(const std::vector<SDL_Point>& vertices, ElementType type);
+	std::vector<SDL_Point> floodFill(int x, int y, ElementType type);
+	std::vector<SDL_Point> clearRegion(int x, int y, int w, int h);
+	RegionSnapshot copyRegion(int x, int y, int w, int h) const;
+	std::vector<SDL_Point> pasteRegion(const RegionSnapshot& region, int x, int y);
 
 	// Main update loop
 	void update();
 
 	// Chunk management
 	void activateChunk(int x, int y) override;
-	void activateNeighboringChunks(int chunkX, int chunkY);
+	void wakeNeighborhood(int x, int y);
+
+	// Coarse gas field. While enabled, gas elements are absorbed into it on their
+	// next update; absorbGas returns false, leaving the cell alone, otherwise.
+	void setGasFieldEnabled(bool enabled) { gasFieldEnabled = enabled; }
+	bool isGasFieldEnabled() const { return gasFieldEnabled; }
+	bool absorbGas(int x, int y);
+	const GasField& getGasField() const { return gasField; }
+
+	// Cell temperatures, conducted every tick (see TemperatureField)
+	float getTemperature(int x, int y) const { return temperatureField.getTemperature(x, y); }
+	void setTemperature(int x, int y, float temperature) { temperatureField.setTemperature(x, y, temperature); }
+	const TemperatureField& getTemperatureField() const { return temperatureField; }
+
+	// Burning cells (see CombustionSystem). Igniting turns a flammable cell into
+	// FIRE that burns for its fuel's burnTime; other cells are left alone.
+	void ignite(int x, int y) override;
+	void igniteSpans(const std::vector<CellSpan>& spans);
+	const CombustionSystem& getCombustion() const { return combustion; }
+
+	// Simulation time and scheduled wake-ups
+	uint64_t getTick() const override { return tick; }
+	void scheduleWake(int x, int y, uint64_t delay) override;
+	size_t getScheduledWakeCount() const { return timers.size() + reactionTimers.size(); }
 	
 	// Debug info
 	void switchDebugMode();
 	bool getDebugMode() const { return debugMode; }
 	int getActiveChunkCount() const;
+	void cycleHeatmapMode();
+	HeatmapMode getHeatmapMode() const { return heatmapMode; }
 
 private:
-	// Grid data
-	Element* matrix[Matrix::HEIGHT][Matrix::WIDTH];
+	// World dimensions
+	int width = 0;
+	int height = 0;
+	int chunksX = 0;
+	int chunksY = 0;
+
+	// Chunk directory (row-major, (chunksX + 2) * (chunksY + 2) including the ghost
+	// ring); nullptr for tiles that are all EMPTY
+	std::vector<Chunk*> chunks;
+	int directoryWidth = 0;
+
+	// Materialized chunks, unordered, and how many of them each chunk row holds
+	std::vector<Chunk*> liveChunks;
+	std::vector<int> rowLiveCount;
+
+	// What reads of unmaterialized tiles see. emptySlot is handed out by the
+	// non-const getElement and re-pointed at emptyCell on every call, so it must
+	// not be written through; placeElement/swapElements materialize instead.
+	Empty emptyCell{0, 0};
+	Element* emptySlot = &emptyCell;
+
+	// Shared, never simulated chunk behind the ghost ring of the directory
+	Wall wallCell{-1, -1};
+	Chunk wallChunk;
 
-	// Chunk system
-	Chunk chunks[g_CHUNKS_Y][g_CHUNKS_X];
+	// Ticks completed so far, and the wake-ups scheduled for later ones
+	uint64_t tick = 0;
+	TimerWheel timers;
+	TimerWheel reactionTimers;  // Keyed on the due tick, so stale ones can be told apart
+	std::vector<TimerWheel::Event> dueWakes;
+
+	// Periodic leveling of resting liquid bodies that are still awake
+	LiquidLeveler liquidLeveler;
+	std::vector<SDL_Point> levelSeeds;
+
+	GasField gasField;
+	bool gasFieldEnabled = false;
+
+	TemperatureField temperatureField;
+	CombustionSystem combustion;
+
+	// Update scratch buffers, reused across ticks
+	std::vector<int> activeChunkColumns;
+	std::vector<int> columnOrder;
+	std::vector<Element*> displacedCells;
+
+	// Bulk placement scratch: stroke rasterizer and spans split at chunk borders
+	struct ChunkSpan {
+		int chunkX, chunkY;
+		CellSpan span;
+	};
+	BrushStroke brushStroke;
+	std::vector<ChunkSpan> chunkSpans;
+	std::vector<ChunkSpan> sortedChunkSpans;
+	std::vector<int> chunkSpanCounts;
+	std::vector<CellSpan> litSpans;
 	
-	// Rendering
+	// Rendering. basePixels holds the converted element colors of the view and is
+	// only refreshed for dirty chunks; pixels is basePixels with particles on top.
 	SDL_Texture* renderTexture = nullptr;
 	std::vector<Uint32> pixels;
+	std::vector<Uint32> basePixels;
+	int viewWidth = 0;
+	int viewHeight = 0;
+	int convertedViewX = 0;
+	int convertedViewY = 0;
+	bool fullConversionPending = true;
+	std::vector<SDL_Point> releasedTiles; // Chunk coordinates released since the last conversion
+
+	// Per-chunk cost heatmap (one texel per chunk in view)
+	SDL_Texture* heatmapTexture = nullptr;
+	std::vector<Uint32> heatmapPixels;
+	int heatmapWidth = 0;
+	int heatmapHeight = 0;
+	HeatmapMode heatmapMode = HEATMAP_OFF;
 	
 	// Random number generation
 	std::mt19937 rng{std::random_device{}()};
@@ -66,11 +241,95 @@ private:
 	static bool globalStep;
 
 	// Helper methods
-	int getChunkX(int worldX) const { return worldX / g_CHUNK_SIZE; }
-	int getChunkY(int worldY) const { return worldY / g_CHUNK_SIZE; }
+	// Chunk coordinates range over [-1, chunksX] x [-1, chunksY], the outer ring being the wall
+	Chunk* chunkAt(int chunkX, int chunkY) const { return chunks[(chunkY + 1) * directoryWidth + chunkX + 1]; }
+	Chunk*& directoryEntry(int chunkX, int chunkY) { return chunks[(chunkY + 1) * directoryWidth + chunkX + 1]; }
+	Chunk* chunkContaining(int x, int y) const { return chunkAt(getChunkX(x), getChunkY(y)); }
+	Element* cellAt(int x, int y) const;
+	Element*& materializedCellAt(int x, int y);
+	void syncEmptyBit(int x, int y);
+	// Floor division/modulo, valid down to one chunk left of or above the world
+	int getChunkX(int worldX) const { return (worldX + g_CHUNK_SIZE) / g_CHUNK_SIZE - 1; }
+	int getChunkY(int worldY) const { return (worldY + g_CHUNK_SIZE) / g_CHUNK_SIZE - 1; }
+	static int getLocal(int world) { return (world + g_CHUNK_SIZE) % g_CHUNK_SIZE; }
 	bool isValidChunk(int chunkX, int chunkY) const;
-	void updateChunk(int chunkX, int chunkY);
-	void updateChunkRow(int chunkX, int chunkY, int row);
+	Chunk& materializeChunk(int chunkX, int chunkY, bool fillEmpty = true);
+	void releaseChunk(Chunk* chunk);
+	void convertTile(int chunkX, int chunkY, int viewX, int viewY);
+	void updateChunkRow(int chunkY);
+	void levelLiquids();
+	// Evaluates the reaction table against the neighbors of an updating cell;
+	// returns whether the cell itself was replaced
+	bool applyReactions(int x, int y, Element& element);
+	// Wakes an element that is not moving when its pending reaction is due
+	void scheduleReaction(int x, int y, Element& element);
+	void activateChunkAndNeighbors(Chunk* chunk);
+	static std::vector<CellSpan> rectSpans(int x, int y, int w, int h);
+	// Clips spans to the world and fills chunkSpans with their pieces, grouped by chunk
+	void splitSpansByChunk(const std::vector<CellSpan>& spans);
+	// Writes typeAt(x, y) into every cell of chunkSpans, one chunk at a time
+	template<typename TypeAt>
+	std::vector<SDL_Point> placeChunkSpans(TypeAt typeAt);
 };
 
+//-------------------------------------------
+// Inline Access (hot path of element kernels)
+//-------------------------------------------
+inline Element* CellularMatrix::cellAt(int x, int y) const {
+	const Chunk* chunk = chunkContaining(x, y);
+	if (!chunk) return const_cast<Empty*>(&emptyCell);
+	return chunk->cellAt(getLocal(x), getLocal(y));
+}
+
+// Call after writing a cell, to bring its chunk's occupancy masks up to date
+inline void CellularMatrix::syncEmptyBit(int x, int y) {
+	Chunk* chunk = chunkContaining(x, y);
+	int localX = getLocal(x);
+	int localY = getLocal(y);
+	chunk->setCellEmpty(localX, localY, chunk->cellAt(localX, localY)->getType() == EMPTY);
+}
+
+inline bool CellularMatrix::isInBounds(int x, int y) const {
+	return x >= 0 && x < width && y >= 0 && y < height;
+}
+
+inline bool CellularMatrix::isEmpty(int x, int y) const {
+	return cellAt(x, y)->getType() == EMPTY;
+}
+
+inline Element*& CellularMatrix::getElement(int x, int y) {
+	if (Chunk* chunk = chunkContaining(x, y)) {
+		return chunk->cellAt(getLocal(x), getLocal(y));
+	}
+	emptySlot = &emptyCell;
+	return emptySlot;
+}
+
+inline const Element* CellularMatrix::getElement(int x, int y) const {
+	return cellAt(x, y);
+}
+
+inline void CellularMatrix::activateChunk(int x, int y) {
+	// Unmaterialized chunks are all EMPTY and have nothing to simulate, and the
+	// border never is
+	if (!isInBounds(x, y)) return;
+	if (Chunk* chunk = chunkContaining(x, y)) {
+		chunk->wakeCell(Chunk::cellIndex(getLocal(x), getLocal(y)));
+		chunk->activate();
+	}
+}
+
+// Wakes (x, y) and its eight neighbors, after the cell at (x, y) changed
+inline void CellularMatrix::wakeNeighborhood(int x, int y) {
+	for (int ny = y - 1; ny <= y + 1; ++ny) {
+		for (int nx = x - 1; nx <= x + 1; ++nx) {
+			activateChunk(nx, ny);
+		}
+	}
+}
+
+inline bool CellularMatrix::isValidChunk(int chunkX, int chunkY) const {
+	return chunkX >= 0 && chunkX < chunksX && chunkY >= 0 && chunkY < chunksY;
+}
+
 #endif // CELLULARMATRIX_HPP
\ No newline at end of file
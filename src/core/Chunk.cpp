@@ -2,13 +2,16 @@
 #include "src/core/Chunk.hpp"
 #include "src/core/Globals.hpp"
 #include "src/core/Renderer.hpp"
+#include "src/elements/Element.hpp"
 
 Chunk::Chunk(int chunkX, int chunkY) 
 	: chunkX(chunkX), chunkY(chunkY), active(true), activeNextFrame(false) {
+	wakeAllCells();
 }
 
 Chunk::Chunk() 
 	: chunkX(0), chunkY(0), active(true), activeNextFrame(false) {
+	wakeAllCells();
 }
 
 bool Chunk::isActive() const {
@@ -25,7 +28,27 @@ void Chunk::deactivate() {
 	activeNextFrame = false;
 }
 
-void Chunk::updateActivityState() {
+bool Chunk::hasAwakeCells() const {
+	for (uint64_t word : awakeCells) {
+		if (word) return true;
+	}
+	return false;
+}
+
+bool Chunk::isAllEmpty() const {
+	for (const Element* cell : cells) {
+		if (cell->getType() != EMPTY) return false;
+	}
+	return true;
+}
+
+bool Chunk::updateActivityState() {
+	// Fold this tick's cost into the exponential moving averages
+	smoothedUpdates += (updatesThisTick - smoothedUpdates) * COST_SMOOTHING;
+	smoothedSwaps += (swapsThisTick - smoothedSwaps) * COST_SMOOTHING;
+	updatesThisTick = 0;
+	swapsThisTick = 0;
+
 	if (activeNextFrame) {
 		active = true;
 		activeNextFrame = false;
@@ -33,8 +56,10 @@ void Chunk::updateActivityState() {
 	} else if (active) {
 		if (--countdown <= 0) {
 			active = false;
+			return true;
 		}
 	}
+	return false;
 }
 
 // Chunk coordinates
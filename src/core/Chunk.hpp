@@ -2,20 +2,72 @@
 #ifndef CHUNK_HPP
 #define CHUNK_HPP
 
+#include <array>
+#include <cstdint>
 #include <vector>
+#include "src/core/Globals.hpp"
 
+class Element;
+
+/**
+ * @brief A g_CHUNK_SIZE x g_CHUNK_SIZE tile of the world.
+ *
+ * Owns the cells of its tile as one contiguous block (row-major or Morton
+ * ordered, see g_MORTON_TILES) together with the activity state used to skip
+ * idle regions. Chunks only exist while their tile holds something other than
+ * EMPTY; see CellularMatrix.
+ */
 class Chunk {
 public:	
+	static constexpr int CELL_COUNT = g_CHUNK_SIZE * g_CHUNK_SIZE;
+	static_assert(g_CHUNK_SIZE <= 64, "Occupancy masks hold one chunk row or column in 64 bits");
+	static_assert(!g_MORTON_TILES || (g_CHUNK_SIZE & (g_CHUNK_SIZE - 1)) == 0,
+				  "Morton ordered tiles need a power of two chunk size");
+
 	Chunk(int chunkX, int chunkY);
 	Chunk();
+
+	// Chunks own their cells and are never copied
+	Chunk(const Chunk&) = delete;
+	Chunk& operator=(const Chunk&) = delete;
+
+	// Cell storage, in tile-local coordinates
+	Element*& cellAt(int localX, int localY) { return cells[cellIndex(localX, localY)]; }
+	Element* cellAt(int localX, int localY) const { return cells[cellIndex(localX, localY)]; }
+	Element** getCells() { return cells; }
+	bool isAllEmpty() const;
+
+	// Mapping between tile-local coordinates and positions in getCells()
+	static constexpr int cellIndex(int localX, int localY);
+	static constexpr int localXOf(int index);
+	static constexpr int localYOf(int index);
+
+	// Set when the tile's pixels need converting again; see CellularMatrix::updateTexture
+	void markTextureDirty() { textureDirty = true; }
+	bool isTextureDirty() const { return textureDirty; }
+	void clearTextureDirty() { textureDirty = false; }
 	
+	// Per-cell sleep state, indexed like getCells(). Only awake cells are
+	// dispatched; a cell sleeps after an update unless something wakes it.
+	void wakeCell(int index) { awakeCells[index / 64] |= uint64_t(1) << (index % 64); }
+	void sleepCell(int index) { awakeCells[index / 64] &= ~(uint64_t(1) << (index % 64)); }
+	bool isCellAwake(int index) const { return (awakeCells[index / 64] >> (index % 64)) & 1; }
+	void wakeAllCells() { awakeCells.fill(~uint64_t(0)); }
+	bool hasAwakeCells() const;
+
+	// EMPTY occupancy, one bit per cell: bit localX of a row mask, bit localY of
+	// a column mask. Kept in step with the cells by CellularMatrix.
+	void setCellEmpty(int localX, int localY, bool empty);
+	uint64_t getEmptyRow(int localY) const { return emptyRows[localY]; }
+	uint64_t getEmptyColumn(int localX) const { return emptyColumns[localX]; }
+
 	// Activity management
 	bool isActive() const;
 	void activate();
 	void deactivate();
 	
-	// Update activity state for next frame
-	void updateActivityState();
+	// Update activity state for next frame; returns true if the chunk just went idle
+	bool updateActivityState();
 	
 	// Chunk coordinates
 	int getChunkX() const;
@@ -24,12 +76,87 @@ public:
 	// Get world coordinates of this chunk
 	int getWorldX() const;
 	int getWorldY() const;
+
+	// Cost tracking for the debug heatmap
+	void recordUpdate() { ++updatesThisTick; }
+	void recordSwap() { ++swapsThisTick; }
+	float getSmoothedUpdates() const { return smoothedUpdates; }
+	float getSmoothedSwaps() const { return smoothedSwaps; }
+
+	// Weight of the newest tick in the smoothed cost values
+	static constexpr float COST_SMOOTHING = 0.05f;
 	
 private:
 	int chunkX, chunkY;
 	bool active;
 	bool activeNextFrame;
 	int countdown = 10;
+
+	int updatesThisTick = 0;
+	int swapsThisTick = 0;
+	float smoothedUpdates = 0.0f;
+	float smoothedSwaps = 0.0f;
+
+	Element* cells[CELL_COUNT] = {};
+	std::array<uint64_t, (CELL_COUNT + 63) / 64> awakeCells;
+	std::array<uint64_t, g_CHUNK_SIZE> emptyRows {};
+	std::array<uint64_t, g_CHUNK_SIZE> emptyColumns {};
+	bool textureDirty = true;
+
+	// Bit interleaving helpers for Morton order (coordinates up to 8 bits)
+	static constexpr int spreadBits(int v) {
+		v &= 0xFF;
+		v = (v | (v << 4)) & 0x0F0F;
+		v = (v | (v << 2)) & 0x3333;
+		v = (v | (v << 1)) & 0x5555;
+		return v;
+	}
+	static constexpr int compactBits(int v) {
+		v &= 0x5555;
+		v = (v | (v >> 1)) & 0x3333;
+		v = (v | (v >> 2)) & 0x0F0F;
+		v = (v | (v >> 4)) & 0x00FF;
+		return v;
+	}
+
+	friend class CellularMatrix;
+	int liveIndex = -1; ///< Position in CellularMatrix's list of materialized chunks
 };
 
+constexpr int Chunk::cellIndex(int localX, int localY) {
+	if constexpr (g_MORTON_TILES) {
+		return spreadBits(localX) | (spreadBits(localY) << 1);
+	} else {
+		return localY * g_CHUNK_SIZE + localX;
+	}
+}
+
+constexpr int Chunk::localXOf(int index) {
+	if constexpr (g_MORTON_TILES) {
+		return compactBits(index);
+	} else {
+		return index % g_CHUNK_SIZE;
+	}
+}
+
+constexpr int Chunk::localYOf(int index) {
+	if constexpr (g_MORTON_TILES) {
+		return compactBits(index >> 1);
+	} else {
+		return index / g_CHUNK_SIZE;
+	}
+}
+
+inline void Chunk::setCellEmpty(int localX, int localY, bool empty) {
+	uint64_t rowBit = uint64_t(1) << localX;
+	uint64_t columnBit = uint64_t(1) << localY;
+	if (empty) {
+		emptyRows[localY] |= rowBit;
+		emptyColumns[localX] |= columnBit;
+	} else {
+		emptyRows[localY] &= ~rowBit;
+		emptyColumns[localX] &= ~columnBit;
+	}
+}
+
 #endif // CHUNK_HPP
\ No newline at end of file
@@ -0,0 +1,178 @@
+// src/core/CombustionSystem.cpp
+#include "src/core/CombustionSystem.hpp"
+#include "src/core/CellularMatrix.hpp"
+#include "src/particles/ParticleManager.hpp"
+
+namespace {
+	// Flame colors a fire cell flickers between; it keeps its color on the other draws
+	constexpr SDL_Color FLAME_COLORS[] = {
+		{255, 240, 128, 215}, // Pale yellow
+		{255, 220, 0, 215},   // Yellow
+		{255, 180, 40, 215},  // Orange-yellow
+		{255, 140, 0, 215},   // Orange
+		{255, 100, 0, 215}    // Orange-red
+	};
+	constexpr int FLICKER_DRAWS = 10;
+
+	constexpr int NEIGHBORS[8][2] = {
+		{-1, -1}, {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}
+	};
+}
+
+void CombustionSystem::resize(int worldWidth, int worldHeight) {
+	width = worldWidth;
+	height = worldHeight;
+	chunksX = (width + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
+	int chunksY = (height + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
+	burning.clear();
+	burningFlags.clear();
+	chunkEmitter.assign(static_cast<size_t>(chunksX) * chunksY, -1);
+}
+
+bool CombustionSystem::track(int x, int y, ElementType fuel) {
+	if (burningFlags.empty()) {
+		burningFlags.assign(static_cast<size_t>(width) * height, 0);
+	}
+	uint8_t& flag = burningFlags[cellIndex(x, y)];
+	if (flag) return false;
+	flag = 1;
+	burning.push_back({x, y, ELEMENT_PROPERTIES[fuel].burnTime, fuel});
+	return true;
+}
+
+bool CombustionSystem::isBurning(int x, int y) const {
+	return !burningFlags.empty() && burningFlags[cellIndex(x, y)];
+}
+
+//-------------------------------------------
+// Burning
+//-------------------------------------------
+void CombustionSystem::update(CellularMatrix& matrix) {
+	if (burning.empty()) return;
+
+	const uint64_t tick = matrix.getTick();
+	const float flameTemperature = ELEMENT_PROPERTIES[FIRE].sourceTemperature;
+
+	size_t kept = 0;
+	for (size_t i = 0; i < burning.size(); ++i) {
+		BurningCell cell = burning[i];
+		Element* element = matrix.getElement(cell.x, cell.y);
+
+		// Put out or painted over since the last tick
+		if (element->getType() != FIRE) {
+			burningFlags[cellIndex(cell.x, cell.y)] = 0;
+			continue;
+		}
+
+		// Burnt out: the fuel's residue, or nothing
+		if (--cell.ticksLeft <= 0) {
+			const ElementProperties& fuel = ELEMENT_PROPERTIES[cell.fuel];
+			bool leavesResidue = fuel.burnResidue != EMPTY && ElementRNG::getRandomChance(fuel.residueChance);
+			queuePlacement(leavesResidue ? fuel.burnResidue : EMPTY, cell.x, cell.y);
+			burningFlags[cellIndex(cell.x, cell.y)] = 0;
+			continue;
+		}
+		burning[kept++] = cell;
+
+		matrix.setTemperature(cell.x, cell.y, flameTemperature);
+
+		// Spread into flammable neighbors, each with its own type's chance
+		for (const auto& offset : NEIGHBORS) {
+			int neighborX = cell.x + offset[0];
+			int neighborY = cell.y + offset[1];
+			ElementType neighborType = matrix.getElement(neighborX, neighborY)->getType();
+			float flammability = ELEMENT_PROPERTIES[neighborType].flammability;
+			if (flammability <= 0.0f || isBurning(neighborX, neighborY)) continue;
+			if (ElementRNG::getRandomChance(flammability)) {
+				burningFlags[cellIndex(neighborX, neighborY)] = 1;
+				ignited.push_back({neighborX, neighborY, ELEMENT_PROPERTIES[neighborType].burnTime, neighborType});
+				queuePlacement(FIRE, neighborX, neighborY);
+			}
+		}
+
+		// A quarter of the fire recolors each tick
+		if ((i + tick) % FLICKER_INTERVAL == 0) {
+			int draw = ElementRNG::getRandomInt(0, FLICKER_DRAWS - 1);
+			if (draw < static_cast<int>(std::size(FLAME_COLORS))) {
+				element->setColor(FLAME_COLORS[draw]);
+				matrix.markTextureDirty(cell.x, cell.y);
+			}
+		}
+
+		// Under open air: smoke at the fuel's rate, and a candidate for the flame particle
+		if (matrix.isEmpty(cell.x, cell.y - 1)) {
+			if (ElementRNG::getRandomChance(ELEMENT_PROPERTIES[cell.fuel].smokeChance)) {
+				queuePlacement(SMOKE, cell.x, cell.y - 1);
+			}
+			considerEmitter(cell);
+		}
+	}
+	burning.resize(kept);
+
+	// One flame particle roll per chunk with fire under open air
+	for (const Emitter& emitter : emitters) {
+		spawnFlameParticle(emitter.cell);
+		chunkEmitter[emitter.chunk] = -1;
+	}
+	emitters.clear();
+
+	flushPlacements(matrix);
+	burning.insert(burning.end(), ignited.begin(), ignited.end());
+	ignited.clear();
+}
+
+void CombustionSystem::considerEmitter(const BurningCell& cell) {
+	int chunk = (cell.y / g_CHUNK_SIZE) * chunksX + cell.x / g_CHUNK_SIZE;
+	int& slot = chunkEmitter[chunk];
+	if (slot < 0) {
+		slot = static_cast<int>(emitters.size());
+		emitters.push_back({chunk, 1, cell});
+		return;
+	}
+	// Every candidate of the chunk is equally likely to be the one that emits
+	Emitter& emitter = emitters[slot];
+	++emitter.candidates;
+	if (ElementRNG::getRandomInt(1, emitter.candidates) == 1) {
+		emitter.cell = cell;
+	}
+}
+
+void CombustionSystem::spawnFlameParticle(const BurningCell& cell) {
+	if (ElementRNG::getRandomChance(CHANCE_TO_SPAWN_PARTICLE)) {
+		const SDL_Color& color = FLAME_COLORS[ElementRNG::getRandomInt(0, static_cast<int>(std::size(FLAME_COLORS)) - 1)];
+		int w = ElementRNG::getRandomInt(1, 2);
+		int h = ElementRNG::getRandomInt(1, 2);
+		float dir = (ElementRNG::getRandomInt(0, 1) == 0) ? -1.0f : 1.0f;
+		float vx = ElementRNG::getRandomFloat(0.0f, 0.3f) * dir;
+		float vy = -ElementRNG::getRandomFloat(0.5f, 1.5f); // upward
+		ParticleManager::spawnParticle({
+			cell.x, cell.y,
+			w, h,
+			color,
+			vx, vy,
+			0, 0,
+			10,
+			1.0f,
+			0.4f
+		});
+	}
+}
+
+//-------------------------------------------
+// Batched Placement
+//-------------------------------------------
+void CombustionSystem::queuePlacement(ElementType type, int x, int y) {
+	std::vector<CellSpan>& spans = placements[type];
+	if (spans.empty()) {
+		placementTypes.push_back(type);
+	}
+	spans.push_back({y, x, x});
+}
+
+void CombustionSystem::flushPlacements(CellularMatrix& matrix) {
+	for (ElementType type : placementTypes) {
+		matrix.placeElementsInSpans(placements[type], type);
+		placements[type].clear();
+	}
+	placementTypes.clear();
+}
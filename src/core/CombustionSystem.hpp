@@ -0,0 +1,88 @@
+// src/core/CombustionSystem.hpp
+#ifndef COMBUSTION_SYSTEM_HPP
+#define COMBUSTION_SYSTEM_HPP
+
+#include "src/core/Globals.hpp"
+#include "src/core/BrushStroke.hpp"
+#include "src/elements/Element.hpp"
+#include <SDL2/SDL.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Burns fire cells and spreads them into fuel.
+ *
+ * Every FIRE cell is on a compact list together with the fuel it burns and
+ * the ticks it has left; the cells themselves sleep. Each tick the list is
+ * walked once: burning cells hold their temperature, light flammable
+ * neighbors with the flammability of the neighbor's type, flicker, and burn
+ * out into their fuel's residue once their burnTime is used up. Every burning
+ * cell with open air above smokes at its fuel's smokeChance; flame particles,
+ * which are only decoration, are capped at one roll per chunk and tick, from
+ * a burning cell with open air above picked at random. Every placement of a
+ * tick (new fires, residues, smoke) goes through
+ * CellularMatrix::placeElementsInSpans in one batch per type, so a large fire
+ * costs a pass over its list rather than an update and an allocation per cell.
+ */
+class CombustionSystem {
+public:
+	static constexpr int FLICKER_INTERVAL = 4;            ///< Ticks between recolors of one fire cell
+	static constexpr float CHANCE_TO_SPAWN_PARTICLE = 0.5f; ///< Per chunk and tick with fire under open air
+
+	/**
+	 * @brief Size the system for a world, with nothing burning.
+	 */
+	void resize(int worldWidth, int worldHeight);
+
+	/**
+	 * @brief Start burning a cell.
+	 * @param fuel Type the cell burns as; FIRE for a bare flame
+	 * @return false if the cell was already burning
+	 */
+	bool track(int x, int y, ElementType fuel);
+
+	bool isBurning(int x, int y) const;
+	size_t getBurningCount() const { return burning.size(); }
+
+	/**
+	 * @brief Burn, spread and emit for one tick.
+	 */
+	void update(CellularMatrix& matrix);
+
+private:
+	struct BurningCell {
+		int x;
+		int y;
+		int ticksLeft;
+		ElementType fuel;
+	};
+
+	size_t cellIndex(int x, int y) const { return static_cast<size_t>(y) * width + x; }
+	void queuePlacement(ElementType type, int x, int y);
+	void flushPlacements(CellularMatrix& matrix);
+	void considerEmitter(const BurningCell& cell);
+	void spawnFlameParticle(const BurningCell& cell);
+
+	int width = 0;
+	int height = 0;
+	int chunksX = 0;
+
+	std::vector<BurningCell> burning;
+	std::vector<uint8_t> burningFlags; ///< Per cell, allocated with the first fire
+
+	// Per-tick scratch: cells lit this tick, placements by type, and the
+	// particle-emitting cell chosen for each chunk (reservoir sampled)
+	std::vector<BurningCell> ignited;
+	std::array<std::vector<CellSpan>, ELEMENT_TYPE_COUNT> placements;
+	std::vector<ElementType> placementTypes;
+	std::vector<int> chunkEmitter;   ///< Per chunk, into emitters, or -1
+	struct Emitter {
+		int chunk;
+		int candidates;
+		BurningCell cell;
+	};
+	std::vector<Emitter> emitters;
+};
+
+#endif // COMBUSTION_SYSTEM_HPP
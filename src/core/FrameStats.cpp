@@ -0,0 +1,116 @@
+// src/core/FrameStats.cpp
+#include "src/core/FrameStats.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+double FrameStats::now() {
+	using namespace std::chrono;
+	return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+//-------------------------------------------
+// Recording
+//-------------------------------------------
+int FrameStats::binFor(float ms) {
+	int bin = static_cast<int>(ms / BIN_WIDTH_MS);
+	return std::clamp(bin, 0, BIN_COUNT - 1);
+}
+
+void FrameStats::record(Metric metric, float ms) {
+	Series& series = m_Series[metric];
+
+	// Evict the oldest sample from the histogram once the window is full
+	if (series.count == HISTORY_SIZE) {
+		--series.bins[binFor(series.samples[series.head])];
+	} else {
+		++series.count;
+	}
+
+	series.samples[series.head] = ms;
+	++series.bins[binFor(ms)];
+	series.head = (series.head + 1) % HISTORY_SIZE;
+}
+
+//-------------------------------------------
+// Queries
+//-------------------------------------------
+float FrameStats::percentile(const Series& series, float fraction) {
+	if (series.count == 0) return 0.0f;
+
+	// Rank of the requested sample, then walk the histogram until it is reached
+	int rank = std::max(1, static_cast<int>(fraction * series.count + 0.5f));
+	int seen = 0;
+	for (int bin = 0; bin < BIN_COUNT - 1; ++bin) {
+		seen += series.bins[bin];
+		if (seen >= rank) {
+			return (bin + 1) * BIN_WIDTH_MS; // upper edge of the bin
+		}
+	}
+
+	// The overflow bin has no upper edge: pick the exact sample among the slow ones
+	std::vector<float> overflow;
+	overflow.reserve(series.bins[BIN_COUNT - 1]);
+	for (int i = 0; i < series.count; ++i) {
+		if (binFor(series.samples[i]) == BIN_COUNT - 1) {
+			overflow.push_back(series.samples[i]);
+		}
+	}
+	size_t nth = std::min(static_cast<size_t>(rank - seen - 1), overflow.size() - 1);
+	std::nth_element(overflow.begin(), overflow.begin() + nth, overflow.end());
+	return overflow[nth];
+}
+
+FrameStats::Summary FrameStats::getSummary(Metric metric) const {
+	const Series& series = m_Series[metric];
+
+	Summary summary;
+	summary.count = series.count;
+	summary.p50 = percentile(series, 0.50f);
+	summary.p95 = percentile(series, 0.95f);
+	summary.p99 = percentile(series, 0.99f);
+	for (int i = 0; i < series.count; ++i) {
+		summary.max = std::max(summary.max, series.samples[i]);
+	}
+	return summary;
+}
+
+float FrameStats::getSample(Metric metric, int index) const {
+	const Series& series = m_Series[metric];
+	int oldest = (series.head - series.count + HISTORY_SIZE) % HISTORY_SIZE;
+	return series.samples[(oldest + index) % HISTORY_SIZE];
+}
+
+int FrameStats::getSampleCount(Metric metric) const {
+	return m_Series[metric].count;
+}
+
+//-------------------------------------------
+// Formatting
+//-------------------------------------------
+const char* FrameStats::getMetricName(Metric metric) {
+	switch (metric) {
+		case SIM:    return "Sim";
+		case RENDER: return "Render";
+		case FRAME:  return "Frame";
+		default:     return "Unknown";
+	}
+}
+
+std::string FrameStats::formatSummary() const {
+	std::string text;
+	char line[128];
+	for (int m = 0; m < METRIC_COUNT; ++m) {
+		Summary s = getSummary(static_cast<Metric>(m));
+		std::snprintf(line, sizeof(line), "%s: p50 %.1f p95 %.1f p99 %.1f max %.1f ms",
+					  getMetricName(static_cast<Metric>(m)), s.p50, s.p95, s.p99, s.max);
+		if (!text.empty()) text += '\n';
+		text += line;
+	}
+	return text;
+}
+
+void FrameStats::print(std::ostream& out) const {
+	out << formatSummary() << '\n';
+}
@@ -0,0 +1,120 @@
+// src/core/FrameStats.hpp
+#ifndef FRAME_STATS_HPP
+#define FRAME_STATS_HPP
+
+#include <array>
+#include <string>
+#include <ostream>
+
+/**
+ * @brief Rolling frame-time statistics for the simulation loop.
+ *
+ * Keeps the last HISTORY_SIZE samples of simulation tick time, render time and
+ * total frame time, together with a fixed-bin histogram of those samples, so
+ * percentiles can be read without sorting. Has no SDL dependency and can be
+ * used the same way in windowed and headless runs.
+ */
+class FrameStats {
+public:
+	/**
+	 * @brief Measured quantities.
+	 */
+	enum Metric {
+		SIM,          ///< Time spent in CellularMatrix::update (per tick)
+		RENDER,       ///< Time spent building and submitting the frame
+		FRAME,        ///< Wall time of one full main loop iteration
+		METRIC_COUNT
+	};
+
+	/**
+	 * @brief Percentile summary of one metric over the rolling window.
+	 */
+	struct Summary {
+		float p50 = 0.0f;
+		float p95 = 0.0f;
+		float p99 = 0.0f;
+		float max = 0.0f;
+		int count = 0;
+	};
+
+	static constexpr int HISTORY_SIZE = 600;      ///< Samples kept per metric
+	static constexpr float BIN_WIDTH_MS = 0.1f;   ///< Histogram resolution
+	static constexpr int BIN_COUNT = 1000;        ///< Bins cover 0..100 ms, last bin is overflow
+
+	/**
+	 * @brief Current time in milliseconds from a monotonic clock.
+	 */
+	static double now();
+
+	/**
+	 * @brief Add one sample to the rolling window of a metric.
+	 * @param metric Metric to record
+	 * @param ms Duration in milliseconds
+	 */
+	void record(Metric metric, float ms);
+
+	/**
+	 * @brief Compute p50/p95/p99/max of a metric over the rolling window.
+	 */
+	Summary getSummary(Metric metric) const;
+
+	/**
+	 * @brief Get a sample from the rolling window, 0 being the oldest.
+	 * @param metric Metric to read
+	 * @param index Index in [0, getSampleCount(metric))
+	 */
+	float getSample(Metric metric, int index) const;
+
+	/**
+	 * @brief Number of samples currently in the rolling window of a metric.
+	 */
+	int getSampleCount(Metric metric) const;
+
+	/**
+	 * @brief Format all metrics as text, one line per metric.
+	 */
+	std::string formatSummary() const;
+
+	/**
+	 * @brief Write all metrics to a stream (used by headless runs).
+	 */
+	void print(std::ostream& out) const;
+
+	/**
+	 * @brief Human-readable metric name.
+	 */
+	static const char* getMetricName(Metric metric);
+
+private:
+	struct Series {
+		std::array<float, HISTORY_SIZE> samples {};
+		std::array<int, BIN_COUNT> bins {};
+		int head = 0;   ///< Next write position in samples
+		int count = 0;  ///< Valid samples in the window
+	};
+
+	static int binFor(float ms);
+	static float percentile(const Series& series, float fraction);
+
+	std::array<Series, METRIC_COUNT> m_Series;
+};
+
+/**
+ * @brief Records the lifetime of a scope into a FrameStats metric.
+ */
+class ScopedFrameTimer {
+public:
+	ScopedFrameTimer(FrameStats& stats, FrameStats::Metric metric)
+		: m_Stats(stats), m_Metric(metric), m_Start(FrameStats::now()) {}
+
+	~ScopedFrameTimer() {
+		m_Stats.record(m_Metric, static_cast<float>(FrameStats::now() - m_Start));
+	}
+
+private:
+	FrameStats& m_Stats;
+	FrameStats::Metric m_Metric;
+	double m_Start;
+};
+
+#endif // FRAME_STATS_HPP
@@ -0,0 +1,214 @@
+// src/core/GasField.cpp
+#include "src/core/GasField.hpp"
+#include "src/core/CellularMatrix.hpp"
+#include <algorithm>
+
+void GasField::resize(int worldWidth, int worldHeight) {
+	blocksX = (worldWidth + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	blocksY = (worldHeight + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	for (std::vector<float>& layer : layers) {
+		layer.clear();
+	}
+	activeTypes.clear();
+	bounds = {0, 0, 0, 0};
+}
+
+void GasField::add(ElementType type, int x, int y, float amount) {
+	int blockX = x / BLOCK_SIZE;
+	int blockY = y / BLOCK_SIZE;
+	if (blockX < 0 || blockX >= blocksX || blockY < 0 || blockY >= blocksY) return;
+
+	std::vector<float>& layer = layers[type];
+	if (layer.empty()) {
+		layer.assign(static_cast<size_t>(blocksX) * blocksY, 0.0f);
+	}
+	if (std::find(activeTypes.begin(), activeTypes.end(), type) == activeTypes.end()) {
+		activeTypes.push_back(type);
+	}
+	at(layer, blockX, blockY) += amount;
+
+	if (bounds.w == 0) {
+		bounds = {blockX, blockY, 1, 1};
+	} else {
+		int x0 = std::min(bounds.x, blockX);
+		int y0 = std::min(bounds.y, blockY);
+		int x1 = std::max(bounds.x + bounds.w, blockX + 1);
+		int y1 = std::max(bounds.y + bounds.h, blockY + 1);
+		bounds = {x0, y0, x1 - x0, y1 - y0};
+	}
+}
+
+float GasField::getTotal(ElementType type) const {
+	float total = 0.0f;
+	for (float concentration : layers[type]) {
+		total += concentration;
+	}
+	return total;
+}
+
+//-------------------------------------------
+// Simulation
+//-------------------------------------------
+void GasField::update(const CellularMatrix& matrix) {
+	if (isEmpty()) return;
+
+	// Gas can only reach one block past where it is now
+	work.x = std::max(bounds.x - 1, 0);
+	work.y = std::max(bounds.y - 1, 0);
+	work.w = std::min(bounds.x + bounds.w + 1, blocksX) - work.x;
+	work.h = std::min(bounds.y + bounds.h + 1, blocksY) - work.y;
+
+	updateCapacity(matrix);
+	for (ElementType type : activeTypes) {
+		stepLayer(type);
+	}
+
+	// Shrink the bounds to what is left, and retire types that are gone
+	int x0 = blocksX, y0 = blocksY, x1 = -1, y1 = -1;
+	for (size_t t = 0; t < activeTypes.size();) {
+		std::vector<float>& layer = layers[activeTypes[t]];
+		bool any = false;
+		for (int blockY = work.y; blockY < work.y + work.h; ++blockY) {
+			for (int blockX = work.x; blockX < work.x + work.w; ++blockX) {
+				float& concentration = at(layer, blockX, blockY);
+				if (concentration < MIN_CONCENTRATION) {
+					concentration = 0.0f;
+					continue;
+				}
+				any = true;
+				x0 = std::min(x0, blockX);
+				y0 = std::min(y0, blockY);
+				x1 = std::max(x1, blockX);
+				y1 = std::max(y1, blockY);
+			}
+		}
+		if (any) {
+			++t;
+		} else {
+			activeTypes.erase(activeTypes.begin() + t);
+		}
+	}
+	bounds = x1 < 0 ? SDL_Rect{0, 0, 0, 0} : SDL_Rect{x0, y0, x1 - x0 + 1, y1 - y0 + 1};
+}
+
+void GasField::updateCapacity(const CellularMatrix& matrix) {
+	// Padded by a ring of zero capacity: nothing flows out of the working
+	// rectangle, which already has a block of room around the gas
+	int paddedWidth = work.w + 2;
+	capacity.assign(static_cast<size_t>(paddedWidth) * (work.h + 2), 0.0f);
+	for (int row = 0; row < work.h; ++row) {
+		float* out = &capacity[static_cast<size_t>(row + 1) * paddedWidth + 1];
+		int y = (work.y + row) * BLOCK_SIZE;
+		for (int col = 0; col < work.w; ++col) {
+			int x = (work.x + col) * BLOCK_SIZE;
+			out[col] = static_cast<float>(matrix.countEmptyInRect(x, y, BLOCK_SIZE, BLOCK_SIZE));
+		}
+	}
+}
+
+void GasField::stepLayer(ElementType type) {
+	const ElementProperties& properties = ELEMENT_PROPERTIES[type];
+	const float rise = RISE_RATE;
+	const float diffusion = DIFFUSION_RATE * properties.chanceOfHorizontal;
+	// Decay with the mean lifetime of a cell: the lifetime, then the expected
+	// wait for the per-tick chance to dissipate
+	float meanLifetime = properties.lifetime +
+		(properties.chanceOfDeathAfterLifetime > 0.0f ? 1.0f / properties.chanceOfDeathAfterLifetime : 0.0f);
+	const float keep = properties.chanceOfDeathAfterLifetime > 0.0f ? 1.0f - 1.0f / std::max(meanLifetime, 1.0f) : 1.0f;
+
+	std::vector<float>& layer = layers[type];
+	int paddedWidth = work.w + 2;
+	size_t paddedSize = static_cast<size_t>(paddedWidth) * (work.h + 2);
+	concentration.assign(paddedSize, 0.0f);
+	density.assign(paddedSize, 0.0f);
+	for (int row = 0; row < work.h; ++row) {
+		const float* in = &at(layer, work.x, work.y + row);
+		size_t base = static_cast<size_t>(row + 1) * paddedWidth + 1;
+		for (int col = 0; col < work.w; ++col) {
+			float amount = in[col];
+			concentration[base + col] = amount;
+			density[base + col] = amount / std::max(capacity[base + col], 1.0f);
+		}
+	}
+
+	// Every exchange between two blocks enters both with opposite signs, so
+	// the stencil conserves gas up to the decay
+	const float* c = concentration.data();
+	const float* d = density.data();
+	const float* cap = capacity.data();
+	for (int row = 0; row < work.h; ++row) {
+		float* out = &at(layer, work.x, work.y + row);
+		size_t base = static_cast<size_t>(row + 1) * paddedWidth + 1;
+		for (int col = 0; col < work.w; ++col) {
+			size_t i = base + col;
+			size_t up = i - paddedWidth;
+			size_t down = i + paddedWidth;
+
+			// Toward lower density, through as many open cells as both blocks have
+			float exchange = std::min(cap[i], cap[i - 1]) * (d[i - 1] - d[i]) +
+							 std::min(cap[i], cap[i + 1]) * (d[i + 1] - d[i]) +
+							 std::min(cap[i], cap[up]) * (d[up] - d[i]) +
+							 std::min(cap[i], cap[down]) * (d[down] - d[i]);
+
+			// Upward, into open blocks and slowing as they fill
+			float riseIn = c[down] * (cap[i] > 0.0f ? 1.0f : 0.0f) * std::max(1.0f - d[i], 0.0f);
+			float riseOut = c[i] * (cap[up] > 0.0f ? 1.0f : 0.0f) * std::max(1.0f - d[up], 0.0f);
+
+			out[col] = (c[i] + diffusion * exchange + rise * (riseIn - riseOut)) * keep;
+		}
+	}
+}
+
+//-------------------------------------------
+// Rendering
+//-------------------------------------------
+void GasField::render(const CellularMatrix& matrix, std::vector<Uint32>& pixels,
+					  int viewX, int viewY, int viewWidth, int viewHeight) const {
+	if (isEmpty()) return;
+
+	// Ordered dithering: a cell shows gas when its threshold is below the
+	// density of its block
+	static constexpr int BAYER[4][4] = {
+		{ 0,  8,  2, 10},
+		{12,  4, 14,  6},
+		{ 3, 11,  1,  9},
+		{15,  7, 13,  5}
+	};
+
+	int firstX = std::max(bounds.x, viewX / BLOCK_SIZE);
+	int firstY = std::max(bounds.y, viewY / BLOCK_SIZE);
+	int lastX = std::min(bounds.x + bounds.w - 1, (viewX + viewWidth - 1) / BLOCK_SIZE);
+	int lastY = std::min(bounds.y + bounds.h - 1, (viewY + viewHeight - 1) / BLOCK_SIZE);
+
+	for (ElementType type : activeTypes) {
+		const std::vector<float>& layer = layers[type];
+		// One fixed color per gas: a per-cell color would be rolled again every
+		// frame and make the dithering flicker
+		SDL_Color color = ElementFactory::getBaseColor(type);
+		Uint32 pixel = (color.r << 24) | (color.g << 16) | (color.b << 8) | color.a;
+		for (int blockY = firstY; blockY <= lastY; ++blockY) {
+			for (int blockX = firstX; blockX <= lastX; ++blockX) {
+				float amount = layer[static_cast<size_t>(blockY) * blocksX + blockX];
+				if (amount <= 0.0f) continue;
+				int worldX = blockX * BLOCK_SIZE;
+				int worldY = blockY * BLOCK_SIZE;
+				float open = static_cast<float>(matrix.countEmptyInRect(worldX, worldY, BLOCK_SIZE, BLOCK_SIZE));
+				float level = std::min(amount / std::max(open, 1.0f), 1.0f) * 16.0f;
+
+				for (int localY = 0; localY < BLOCK_SIZE; ++localY) {
+					for (int localX = 0; localX < BLOCK_SIZE; ++localX) {
+						if (BAYER[localY % 4][localX % 4] + 0.5f >= level) continue;
+						int x = worldX + localX;
+						int y = worldY + localY;
+						int px = x - viewX;
+						int py = y - viewY;
+						if (px < 0 || px >= viewWidth || py < 0 || py >= viewHeight) continue;
+						if (!matrix.isInBounds(x, y) || !matrix.isEmpty(x, y)) continue;
+
+						pixels[static_cast<size_t>(py) * viewWidth + px] = pixel;
+					}
+				}
+			}
+		}
+	}
+}
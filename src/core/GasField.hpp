@@ -0,0 +1,89 @@
+// src/core/GasField.hpp
+#ifndef GAS_FIELD_HPP
+#define GAS_FIELD_HPP
+
+#include "src/core/Globals.hpp"
+#include "src/elements/Element.hpp"
+#include <SDL2/SDL.h>
+#include <array>
+#include <vector>
+
+/**
+ * @brief Coarse-grid representation of gases, as concentrations per block.
+ *
+ * An optional replacement for simulating every gas cell: gas elements are
+ * absorbed into a BLOCK_SIZE x BLOCK_SIZE grid holding, per gas type, how
+ * many cells' worth of gas each block contains. Every tick the field rises
+ * and diffuses with a branch-free stencil over contiguous rows, bounded by how
+ * many EMPTY cells each block has, and decays with the mean lifetime of the
+ * gas. Gas in the field does not block anything; it is turned back into
+ * visible cells, dithered over the EMPTY cells of each block, only when the
+ * view is drawn.
+ */
+class GasField {
+public:
+	static constexpr int BLOCK_SIZE = 4;
+	static_assert(g_CHUNK_SIZE % BLOCK_SIZE == 0, "Blocks must not straddle chunks");
+
+	/**
+	 * @brief Size the field for a world, dropping all gas.
+	 */
+	void resize(int worldWidth, int worldHeight);
+
+	/**
+	 * @brief Add gas of a type at a world position.
+	 * @param amount Cells' worth of gas
+	 */
+	void add(ElementType type, int x, int y, float amount = 1.0f);
+
+	/**
+	 * @brief Rise, diffuse and decay all gas by one tick.
+	 * @param matrix World the gas moves through, for the EMPTY cells per block
+	 */
+	void update(const CellularMatrix& matrix);
+
+	/**
+	 * @brief Draw the gas into the EMPTY cells of a view-sized pixel buffer.
+	 */
+	void render(const CellularMatrix& matrix, std::vector<Uint32>& pixels,
+				int viewX, int viewY, int viewWidth, int viewHeight) const;
+
+	bool isEmpty() const { return activeTypes.empty(); }
+
+	/**
+	 * @brief Total gas of a type, in cells.
+	 */
+	float getTotal(ElementType type) const;
+
+private:
+	// Per-tick rates; together they move at most the whole content of a block
+	static constexpr float RISE_RATE = 1.0f / BLOCK_SIZE;    ///< Share rising a block, like one cell per tick
+	static constexpr float DIFFUSION_RATE = 0.125f;          ///< Sideways exchange at chanceOfHorizontal 1
+	static constexpr float MIN_CONCENTRATION = 1.0f / 256.0f; ///< Less is dropped
+
+	float& at(std::vector<float>& grid, int blockX, int blockY) {
+		return grid[static_cast<size_t>(blockY) * blocksX + blockX];
+	}
+
+	// Recomputes the EMPTY cell count of the blocks in the working rectangle
+	void updateCapacity(const CellularMatrix& matrix);
+	void stepLayer(ElementType type);
+
+	int blocksX = 0;
+	int blocksY = 0;
+
+	// One concentration grid per gas type, allocated once the type is added
+	std::array<std::vector<float>, ELEMENT_TYPE_COUNT> layers;
+	std::vector<ElementType> activeTypes;
+
+	// Blocks holding gas, and the blocks a step works on (those plus a ring)
+	SDL_Rect bounds {0, 0, 0, 0};
+	SDL_Rect work {0, 0, 0, 0};
+
+	// Per-step copies of the working rectangle, padded by one block
+	std::vector<float> capacity;
+	std::vector<float> concentration;
+	std::vector<float> density;
+};
+
+#endif // GAS_FIELD_HPP
@@ -11,15 +11,18 @@ namespace Window {
 	const static int HEIGHT = 648;
 };
 
+// Default world size; the actual size is a runtime parameter of CellularMatrix
 namespace Matrix {
-	const static int WIDTH = 384;
-	const static int HEIGHT = 216;
+	const static int DEFAULT_WIDTH = 384;
+	const static int DEFAULT_HEIGHT = 216;
+	const static int DEFAULT_CELL_SCALE = 3; // Window pixels per cell
 };
 
 const static int g_CHUNK_SIZE = 8;
 
-const static int g_CHUNKS_X = (Matrix::WIDTH + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
-const static int g_CHUNKS_Y = (Matrix::HEIGHT + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
+// Store the cells of a chunk in Morton (Z-curve) order instead of row-major,
+// keeping 2x2 neighborhoods within the same few bytes of the tile
+const static bool g_MORTON_TILES = false;
 
 const static float g_PHYSICS_HZ = 60.0f;
 const static float g_MS_PER_UPDATE = 1000.0f / g_PHYSICS_HZ;
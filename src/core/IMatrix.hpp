@@ -3,6 +3,7 @@
 #define IMATRIX_HPP
 
 #include "src/elements/ElementFactory.hpp"
+#include <cstdint>
 
 // Forward declaration
 class Element;
@@ -17,7 +18,8 @@ class IMatrix {
 public:
 	virtual ~IMatrix() = default;
 	
-	// Bounds checking
+	// Bounds checking. Element kernels may skip it for direct neighbors:
+	// the cells one step outside the world read as an immutable WALL.
 	virtual bool isInBounds(int x, int y) const = 0;
 	
 	// Type checking
@@ -30,8 +32,18 @@ public:
 	virtual void destroyElement(int x, int y) = 0;
 	virtual void swapElements(int x1, int y1, int x2, int y2) = 0;
 
-	// Chunk Management 
+	// Chunk Management. Wakes the cell at (x, y) so it is updated again next
+	// tick; elements call it on themselves while they have work left to do.
 	virtual void activateChunk(int x, int y) = 0;
+
+	// Simulation time. scheduleWake wakes the cell at (x, y) delay ticks from
+	// now (at least one), for elements that only wait, e.g. to expire.
+	virtual uint64_t getTick() const = 0;
+	virtual void scheduleWake(int x, int y, uint64_t delay) = 0;
+
+	// Combustion. Hands the cell at (x, y) to the matrix's combustion, which
+	// burns it from then on; a fire cell calls it on itself.
+	virtual void ignite(int x, int y) = 0;
 };
 
 #endif // IMATRIX_HPP
\ No newline at end of file
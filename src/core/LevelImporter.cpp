@@ -0,0 +1,135 @@
+// src/core/LevelImporter.cpp
+#include "src/core/LevelImporter.hpp"
+#include "src/core/CellularMatrix.hpp"
+#include "src/elements/ElementFactory.hpp"
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+//-------------------------------------------
+// Loading
+//-------------------------------------------
+bool LevelImporter::loadPalette(const std::string& path) {
+	std::ifstream file(path);
+	if (!file) {
+		std::cerr << "Failed to open palette: " << path << '\n';
+		return false;
+	}
+
+	palette.clear();
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(file, line)) {
+		++lineNumber;
+		line = line.substr(0, line.find('#'));
+		std::istringstream entry(line);
+		int r, g, b;
+		std::string name;
+		if (!(entry >> r >> g >> b)) continue; // blank or comment line
+		entry >> name;
+
+		// Match the name against the registered elements, ignoring case
+		auto sameName = [&name](const std::string& registered) {
+			return registered.size() == name.size() &&
+				std::equal(name.begin(), name.end(), registered.begin(), [](char a, char c) {
+					return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(c));
+				});
+		};
+		int type = 0;
+		while (type < ELEMENT_TYPE_COUNT && !sameName(ElementFactory::getElementName(static_cast<ElementType>(type)))) {
+			++type;
+		}
+		if (type == ELEMENT_TYPE_COUNT || type == WALL) {
+			std::cerr << path << ':' << lineNumber << ": unknown element \"" << name << "\"\n";
+			return false;
+		}
+		Uint32 key = ((r & 0xFF) << 16) | ((g & 0xFF) << 8) | (b & 0xFF);
+		palette[key] = static_cast<ElementType>(type);
+	}
+	return true;
+}
+
+bool LevelImporter::loadImage(const std::string& path) {
+	SDL_Surface* surface = IMG_Load(path.c_str());
+	if (!surface) {
+		std::cerr << "Failed to load level image: " << path << '\n';
+		return false;
+	}
+	SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA8888, 0);
+	SDL_FreeSurface(surface);
+	if (!converted) {
+		std::cerr << "Failed to convert level image: " << path << '\n';
+		return false;
+	}
+
+	SDL_LockSurface(converted);
+	std::vector<Uint32> pixels(static_cast<size_t>(converted->w) * converted->h);
+	for (int y = 0; y < converted->h; ++y) {
+		const Uint8* row = static_cast<const Uint8*>(converted->pixels) + y * converted->pitch;
+		memcpy(&pixels[static_cast<size_t>(y) * converted->w], row, converted->w * sizeof(Uint32));
+	}
+	SDL_UnlockSurface(converted);
+	setImage(converted->w, converted->h, std::move(pixels));
+	SDL_FreeSurface(converted);
+	return true;
+}
+
+void LevelImporter::setImage(int width, int height, std::vector<Uint32> pixels) {
+	imageWidth = width;
+	imageHeight = height;
+	imagePixels = std::move(pixels);
+}
+
+//-------------------------------------------
+// Import
+//-------------------------------------------
+ElementType LevelImporter::typeOfPixel(Uint32 pixel) const {
+	if ((pixel & 0xFF) < 128) return EMPTY;
+	auto it = palette.find(pixel >> 8);
+	return it != palette.end() ? it->second : EMPTY;
+}
+
+std::vector<SDL_Point> LevelImporter::importInto(CellularMatrix& matrix, int originX, int originY) const {
+	// Only the part of the image that lands inside the world
+	int firstCol = std::max(0, -originX);
+	int lastCol = std::min(imageWidth, matrix.getWidth() - originX);
+	int firstRow = std::max(0, -originY);
+	int lastRow = std::min(imageHeight, matrix.getHeight() - originY);
+	if (firstCol >= lastCol || firstRow >= lastRow) return {};
+
+	// Bands line up with chunk rows, so each band materializes its chunks once
+	// and the snapshot stays small however large the image is
+	CellularMatrix::RegionSnapshot band;
+	band.width = lastCol - firstCol;
+	std::vector<SDL_Point> changedChunks;
+	int row = firstRow;
+	while (row < lastRow) {
+		int worldY = originY + row;
+		band.height = std::min(g_CHUNK_SIZE - worldY % g_CHUNK_SIZE, lastRow - row);
+		band.types.resize(static_cast<size_t>(band.width) * band.height);
+
+		// Pixels in a run usually share a color, so remember the last lookup
+		Uint32 lastPixel = 0;
+		ElementType lastType = EMPTY;
+		for (int bandRow = 0; bandRow < band.height; ++bandRow) {
+			const Uint32* source = &imagePixels[static_cast<size_t>(row + bandRow) * imageWidth + firstCol];
+			ElementType* target = &band.types[static_cast<size_t>(bandRow) * band.width];
+			for (int col = 0; col < band.width; ++col) {
+				if (source[col] != lastPixel) {
+					lastPixel = source[col];
+					lastType = typeOfPixel(lastPixel);
+				}
+				target[col] = lastType;
+			}
+		}
+
+		std::vector<SDL_Point> changed = matrix.pasteRegion(band, originX + firstCol, worldY);
+		changedChunks.insert(changedChunks.end(), changed.begin(), changed.end());
+		row += band.height;
+	}
+	return changedChunks;
+}
@@ -0,0 +1,63 @@
+// src/core/LevelImporter.hpp
+#ifndef LEVEL_IMPORTER_HPP
+#define LEVEL_IMPORTER_HPP
+
+#include "src/elements/Element.hpp"
+#include <SDL2/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class CellularMatrix;
+
+/**
+ * @brief Builds worlds from level images.
+ *
+ * A palette file maps pixel colors to element types, one "r g b Name" entry
+ * per line ('#' starts a comment). Images are converted once to packed
+ * RGBA8888 and written into the world in chunk-high bands through
+ * CellularMatrix::pasteRegion, so importing never goes through placeElement.
+ * Needs SDL_image but no window or renderer, so it also works headless.
+ */
+class LevelImporter {
+public:
+	static constexpr const char* DEFAULT_PALETTE_PATH = "assets/levels/palette.txt";
+
+	/**
+	 * @brief Read a palette file, replacing the current palette.
+	 * @return false if the file cannot be opened or has an invalid entry
+	 */
+	bool loadPalette(const std::string& path);
+
+	/**
+	 * @brief Load a level image (any format SDL_image reads).
+	 */
+	bool loadImage(const std::string& path);
+
+	/**
+	 * @brief Use already packed RGBA8888 pixels as the level image.
+	 */
+	void setImage(int width, int height, std::vector<Uint32> pixels);
+
+	int getImageWidth() const { return imageWidth; }
+	int getImageHeight() const { return imageHeight; }
+
+	/**
+	 * @brief Write the image into the world with its top left corner at (originX, originY).
+	 *
+	 * Unlisted colors and pixels with alpha below 128 become EMPTY; the part of
+	 * the image outside the world is ignored.
+	 * @return Chunk coordinates that changed
+	 */
+	std::vector<SDL_Point> importInto(CellularMatrix& matrix, int originX = 0, int originY = 0) const;
+
+private:
+	ElementType typeOfPixel(Uint32 pixel) const;
+
+	std::unordered_map<Uint32, ElementType> palette; ///< Keyed by 0xRRGGBB
+	int imageWidth = 0;
+	int imageHeight = 0;
+	std::vector<Uint32> imagePixels;
+};
+
+#endif // LEVEL_IMPORTER_HPP
@@ -0,0 +1,339 @@
+// src/core/LiquidLeveler.cpp
+#include "src/core/LiquidLeveler.hpp"
+#include "src/core/CellularMatrix.hpp"
+#include "src/elements/movable/falling/liquid/LiquidElement.hpp"
+#include <algorithm>
+
+bool LiquidLeveler::isLiquid(const Element* element) {
+	int8_t& cached = liquidTypes[element->getType()];
+	if (cached < 0) {
+		cached = element->as<LiquidElement>() ? 1 : 0;
+	}
+	return cached;
+}
+
+void LiquidLeveler::startPass(const std::vector<SDL_Point>& passSeeds, uint64_t tick) {
+	seeds.assign(passSeeds.begin(), passSeeds.end());
+	nextSeed = 0;
+	passMoved = 0;
+	passStart = tick;
+	seenChunks.clear();
+	phase = SEEKING;
+}
+
+int LiquidLeveler::step(CellularMatrix& matrix) {
+	width = matrix.getWidth();
+	height = matrix.getHeight();
+
+	int movedBefore = passMoved;
+	int budget = CELLS_PER_TICK;
+	while (budget > 0 && phase != IDLE) {
+		switch (phase) {
+			case SEEKING:
+				if (nextSeed == seeds.size()) {
+					endPass();
+				} else {
+					budget -= seekBody(matrix, budget);
+				}
+				break;
+			case COLLECTING:
+				budget -= collectBody(matrix, budget);
+				break;
+			case FLOODING:
+				budget -= floodBody(matrix, budget);
+				break;
+			case MOVING:
+				budget -= moveBody(matrix, budget);
+				break;
+			case IDLE:
+				break;
+		}
+	}
+	return passMoved - movedBefore;
+}
+
+void LiquidLeveler::endPass() {
+	interval = passMoved > 0 ? MIN_INTERVAL : std::min(interval * 2, MAX_INTERVAL);
+	nextPass = passStart + interval;
+	seeds.clear();
+	seenChunks.clear();
+	phase = IDLE;
+}
+
+//-------------------------------------------
+// Marks
+//-------------------------------------------
+uint8_t LiquidLeveler::markOf(int x, int y) const {
+	int col = x - marksX;
+	int row = y - marksY;
+	if (col < 0 || col >= marksWidth || row < 0 || row >= marksHeight) return 0;
+	return marks[static_cast<size_t>(row) * marksWidth + col];
+}
+
+uint8_t& LiquidLeveler::markAt(int x, int y) {
+	coverMarks(x, y, x, y);
+	return marks[static_cast<size_t>(y - marksY) * marksWidth + (x - marksX)];
+}
+
+void LiquidLeveler::coverMarks(int x0, int y0, int x1, int y1) {
+	int oldX1 = marksX + marksWidth - 1;
+	int oldY1 = marksY + marksHeight - 1;
+	if (marksWidth > 0 && x0 >= marksX && y0 >= marksY && x1 <= oldX1 && y1 <= oldY1) return;
+
+	// Grow by at least the current size on each side that needs it, so a body
+	// found cell by cell is copied a logarithmic number of times
+	int newX0, newY0, newX1, newY1;
+	if (marksWidth == 0) {
+		newX0 = x0 - g_CHUNK_SIZE;
+		newY0 = y0 - g_CHUNK_SIZE;
+		newX1 = x1 + g_CHUNK_SIZE;
+		newY1 = y1 + g_CHUNK_SIZE;
+	} else {
+		newX0 = x0 < marksX ? std::min(x0, marksX - marksWidth) : marksX;
+		newY0 = y0 < marksY ? std::min(y0, marksY - marksHeight) : marksY;
+		newX1 = x1 > oldX1 ? std::max(x1, oldX1 + marksWidth) : oldX1;
+		newY1 = y1 > oldY1 ? std::max(y1, oldY1 + marksHeight) : oldY1;
+	}
+	newX0 = std::max(newX0, 0);
+	newY0 = std::max(newY0, 0);
+	newX1 = std::min(newX1, width - 1);
+	newY1 = std::min(newY1, height - 1);
+
+	int newWidth = newX1 - newX0 + 1;
+	int newHeight = newY1 - newY0 + 1;
+	grownMarks.assign(static_cast<size_t>(newWidth) * newHeight, 0);
+	for (int row = 0; row < marksHeight; ++row) {
+		std::copy_n(&marks[static_cast<size_t>(row) * marksWidth], marksWidth,
+					&grownMarks[static_cast<size_t>(row + marksY - newY0) * newWidth + (marksX - newX0)]);
+	}
+	marks.swap(grownMarks);
+	marksX = newX0;
+	marksY = newY0;
+	marksWidth = newWidth;
+	marksHeight = newHeight;
+}
+
+bool LiquidLeveler::isSeen(int x, int y) const {
+	if (seenChunks.empty()) return false;
+	int chunksX = (width + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
+	auto it = seenChunks.find((y / g_CHUNK_SIZE) * chunksX + x / g_CHUNK_SIZE);
+	return it != seenChunks.end() && it->second[(y % g_CHUNK_SIZE) * g_CHUNK_SIZE + x % g_CHUNK_SIZE];
+}
+
+void LiquidLeveler::markBodySeen() {
+	// Body cells come in row runs, so consecutive cells mostly share a chunk
+	int chunksX = (width + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
+	int lastKey = -1;
+	std::bitset<g_CHUNK_SIZE * g_CHUNK_SIZE>* seen = nullptr;
+	for (SDL_Point cell : body) {
+		int key = (cell.y / g_CHUNK_SIZE) * chunksX + cell.x / g_CHUNK_SIZE;
+		if (key != lastKey) {
+			seen = &seenChunks[key];
+			lastKey = key;
+		}
+		seen->set((cell.y % g_CHUNK_SIZE) * g_CHUNK_SIZE + cell.x % g_CHUNK_SIZE);
+	}
+}
+
+//-------------------------------------------
+// Bodies
+//-------------------------------------------
+bool LiquidLeveler::isSettled(CellularMatrix& matrix, int x, int y) const {
+	const Element* element = matrix.getElement(x, y);
+	return element->getType() == bodyType &&
+		   static_cast<const MovableElement*>(element)->getVelocityY() == 0.0f &&
+		   !matrix.isEmpty(x, y + 1);
+}
+
+int LiquidLeveler::seekBody(CellularMatrix& matrix, int budget) {
+	int handled = 0;
+	while (handled < budget && nextSeed < seeds.size()) {
+		SDL_Point seed = seeds[nextSeed++];
+		++handled;
+		// Seeds in a body already handled, or emptied by its moves, start nothing
+		if (isSeen(seed.x, seed.y)) continue;
+		const Element* element = matrix.getElement(seed.x, seed.y);
+		if (!isLiquid(element)) continue;
+
+		bodyType = element->getType();
+		body.clear();
+		bodyMin = seed;
+		bodyMax = seed;
+		marksWidth = 0;
+		marksHeight = 0;
+		stack.clear();
+		stack.push_back(seed);
+		phase = COLLECTING;
+		break;
+	}
+	return handled;
+}
+
+int LiquidLeveler::collectBody(CellularMatrix& matrix, int budget) {
+	// Scanline flood over the 4-connected settled cells of the liquid, as in
+	// CellularMatrix::floodFill. Falling cells are left to the simulation.
+	auto matches = [&](int x, int y) {
+		if ((markOf(x, y) & CURRENT) || isSeen(x, y)) return false;
+		return isSettled(matrix, x, y);
+	};
+
+	int handled = 0;
+	while (handled < budget && !stack.empty()) {
+		SDL_Point start = stack.back();
+		stack.pop_back();
+		++handled;
+		if (!matches(start.x, start.y)) continue;
+
+		int x0 = start.x, x1 = start.x;
+		while (x0 > 0 && matches(x0 - 1, start.y)) --x0;
+		while (x1 < width - 1 && matches(x1 + 1, start.y)) ++x1;
+		for (int x = x0; x <= x1; ++x) {
+			markAt(x, start.y) |= CURRENT;
+			body.push_back({x, start.y});
+		}
+		handled += x1 - x0;
+		bodyMin = {std::min(bodyMin.x, x0), std::min(bodyMin.y, start.y)};
+		bodyMax = {std::max(bodyMax.x, x1), std::max(bodyMax.y, start.y)};
+
+		for (int y : {start.y - 1, start.y + 1}) {
+			if (y < 0 || y >= height) continue;
+			bool inRun = false;
+			for (int x = x0; x <= x1; ++x) {
+				bool match = matches(x, y);
+				if (match && !inRun) {
+					stack.push_back({x, y});
+				}
+				inRun = match;
+			}
+		}
+	}
+
+	if (stack.empty()) {
+		markBodySeen();
+		if (static_cast<int>(body.size()) >= MIN_BODY_SIZE) {
+			beginFlood();
+		} else {
+			phase = SEEKING;
+		}
+	}
+	return handled;
+}
+
+void LiquidLeveler::beginFlood() {
+	// The flood stays within the rows of the body, so liquid never climbs above
+	// its highest surface or drops below its bottom, and may only spread MARGIN
+	// cells past it sideways per pass
+	floodMin = {std::max(bodyMin.x - MARGIN, 0), bodyMin.y};
+	floodMax = {std::min(bodyMax.x + MARGIN, width - 1), bodyMax.y};
+	coverMarks(floodMin.x, floodMin.y, floodMax.x, floodMax.y);
+
+	size_t bucketCount = static_cast<size_t>(floodMax.y - floodMin.y + 1) * 2;
+	if (frontier.size() < bucketCount) {
+		frontier.resize(bucketCount);
+	}
+	filled = 0;
+
+	auto lowest = std::max_element(body.begin(), body.end(),
+								   [](SDL_Point a, SDL_Point b) { return a.y < b.y; });
+	uint8_t& mark = markAt(lowest->x, lowest->y);
+	mark |= QUEUED;
+	frontier[static_cast<size_t>(lowest->y - floodMin.y) * 2].push_back(lowest->x);
+	floodRow = lowest->y;
+	phase = FLOODING;
+}
+
+int LiquidLeveler::floodBody(CellularMatrix& matrix, int budget) {
+	// Bucket queue, two buckets per row: lowest row first, and on a row the
+	// cells the liquid already holds before empty ones. A push is at most one
+	// row below the cell just taken, so finding the next cell is amortized O(1).
+	auto bucketOf = [&](int y, bool held) -> std::vector<int>& {
+		return frontier[static_cast<size_t>(y - floodMin.y) * 2 + (held ? 0 : 1)];
+	};
+	auto push = [&](int x, int y) {
+		uint8_t& mark = markAt(x, y);
+		mark |= QUEUED;
+		bucketOf(y, mark & CURRENT).push_back(x);
+		floodRow = std::max(floodRow, y);
+	};
+	auto passable = [&](int x, int y) {
+		if (x < floodMin.x || x > floodMax.x || y < floodMin.y || y > floodMax.y) return false;
+		uint8_t mark = markOf(x, y);
+		if (mark & QUEUED) return false;
+		return (mark & CURRENT) || matrix.isEmpty(x, y);
+	};
+
+	int handled = 0;
+	bool exhausted = false;
+	while (handled < budget && filled < body.size()) {
+		while (floodRow >= floodMin.y && bucketOf(floodRow, true).empty() && bucketOf(floodRow, false).empty()) {
+			--floodRow;
+		}
+		if (floodRow < floodMin.y) {
+			exhausted = true;
+			break;
+		}
+		std::vector<int>& bucket = bucketOf(floodRow, true).empty() ? bucketOf(floodRow, false) : bucketOf(floodRow, true);
+		int x = bucket.back();
+		int y = floodRow;
+		bucket.pop_back();
+
+		uint8_t& mark = markAt(x, y);
+		mark |= TARGET;
+		++filled;
+		++handled;
+
+		if (passable(x, y + 1)) push(x, y + 1);
+		if (passable(x - 1, y)) push(x - 1, y);
+		if (passable(x + 1, y)) push(x + 1, y);
+		if (passable(x, y - 1)) push(x, y - 1);
+	}
+
+	if (exhausted || filled >= body.size()) {
+		beginMoves();
+	}
+	return handled;
+}
+
+void LiquidLeveler::beginMoves() {
+	size_t bucketCount = static_cast<size_t>(floodMax.y - floodMin.y + 1) * 2;
+	for (size_t i = 0; i < bucketCount; ++i) {
+		frontier[i].clear();
+	}
+	nextHole = {floodMin.x, floodMax.y};
+	nextSource = floodMin;
+	phase = MOVING;
+}
+
+int LiquidLeveler::moveBody(CellularMatrix& matrix, int budget) {
+	// Liquid the flood did not take drops into the cells it took that are
+	// empty, the highest cells into the lowest holes, as long as that is a move
+	// down. Surface cells and the holes between them keep wandering while the
+	// pass runs, so both are looked up on the tick of the move: holes from the
+	// bottom of the flood up, then sources from the top down among the cells
+	// the body held or the flood reached.
+	int handled = 0;
+	while (handled < budget && nextSource.y < nextHole.y) {
+		++handled;
+		if (!(markOf(nextHole.x, nextHole.y) & TARGET) || !matrix.isEmpty(nextHole.x, nextHole.y)) {
+			if (++nextHole.x > floodMax.x) {
+				nextHole.x = floodMin.x;
+				--nextHole.y;
+			}
+			continue;
+		}
+		uint8_t mark = markOf(nextSource.x, nextSource.y);
+		if ((mark & (CURRENT | QUEUED)) && !(mark & TARGET) && isSettled(matrix, nextSource.x, nextSource.y)) {
+			matrix.swapElements(nextSource.x, nextSource.y, nextHole.x, nextHole.y);
+			++passMoved;
+		}
+		if (++nextSource.x > floodMax.x) {
+			nextSource.x = floodMin.x;
+			++nextSource.y;
+		}
+	}
+
+	if (nextSource.y >= nextHole.y) {
+		phase = SEEKING;
+	}
+	return handled;
+}
@@ -0,0 +1,150 @@
+// src/core/LiquidLeveler.hpp
+#ifndef LIQUID_LEVELER_HPP
+#define LIQUID_LEVELER_HPP
+
+#include "src/core/Globals.hpp"
+#include "src/elements/Element.hpp"
+#include <SDL2/SDL.h>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Brings resting bodies of liquid to a level surface.
+ *
+ * Random-walk spreading needs thousands of ticks to level a large body of
+ * liquid, and keeps its chunks awake all that time. The leveler instead
+ * computes the equilibrium shape of a body directly: a priority flood from the
+ * bottom of the body takes the lowest reachable cells first, as many as the
+ * body holds, so vessels connected through the liquid end at one level. The
+ * cells above that level are then moved straight into the empty cells below
+ * it. Falling cells are not part of any body and are left to the simulation.
+ *
+ * A pass is spread over as many ticks as it needs, handling at most
+ * CELLS_PER_TICK cells per tick, so a large body never stalls a single tick.
+ * The world keeps moving meanwhile, so the cells to move and the holes they
+ * go to are looked up on the tick they are moved.
+ *
+ * A level body still has a few cells wandering on its surface, which would
+ * have the whole body walked every pass; passes that move nothing therefore
+ * back off, up to MAX_INTERVAL ticks apart.
+ */
+class LiquidLeveler {
+public:
+	static constexpr int MIN_INTERVAL = 16;       ///< Ticks between passes while liquid is moved
+	static constexpr int MAX_INTERVAL = 256;      ///< Ticks between passes once nothing is
+	static constexpr int MIN_BODY_SIZE = 64;      ///< Smaller bodies are left to spreading
+	static constexpr int MARGIN = g_CHUNK_SIZE;   ///< How far sideways past its bounds a body may spread per pass
+	static constexpr int CELLS_PER_TICK = 16384;  ///< Cells a pass gathers, floods or scans per tick
+
+	/**
+	 * @brief Whether the leveler has work on the given tick: a pass is running or due.
+	 */
+	bool isDue(uint64_t tick) const { return phase != IDLE || tick >= nextPass; }
+
+	/**
+	 * @brief Whether a pass is in progress; a new one needs seeds first.
+	 */
+	bool isPassRunning() const { return phase != IDLE; }
+
+	/**
+	 * @brief Whether the element is a liquid, cached per element type.
+	 */
+	bool isLiquid(const Element* element);
+
+	/**
+	 * @brief Start a pass over every body of liquid that contains one of the seed cells.
+	 * @param seeds Liquid cells, typically the awake ones
+	 * @param tick Current tick, from which the next pass is scheduled
+	 */
+	void startPass(const std::vector<SDL_Point>& seeds, uint64_t tick);
+
+	/**
+	 * @brief Advance the running pass by up to CELLS_PER_TICK cells.
+	 * @param matrix The world
+	 * @return Number of cells moved on this tick
+	 */
+	int step(CellularMatrix& matrix);
+
+private:
+	enum Phase {
+		IDLE,        ///< Waiting for the next pass
+		SEEKING,     ///< Looking for the next seed outside the bodies seen so far
+		COLLECTING,  ///< Gathering the cells of a body
+		FLOODING,    ///< Running the priority flood over a body
+		MOVING       ///< Moving the liquid the flood did not take into the holes it took
+	};
+
+	// Per-cell flags of the body being leveled
+	enum Mark : uint8_t {
+		CURRENT = 1,  ///< In the body
+		QUEUED = 2,   ///< Pushed onto the flood frontier
+		TARGET = 4    ///< Taken by the flood; liquid ends up here
+	};
+
+	// Marks cover the bounding box of the current body and grow as it is found
+	uint8_t markOf(int x, int y) const;
+	uint8_t& markAt(int x, int y);
+	void coverMarks(int x0, int y0, int x1, int y1);
+
+	// Cells of the bodies already handled in this pass, per chunk
+	bool isSeen(int x, int y) const;
+	void markBodySeen();
+
+	// Whether the cell holds the body's liquid, at rest on something
+	bool isSettled(CellularMatrix& matrix, int x, int y) const;
+
+	// Each returns the number of cells it handled, at most budget
+	int seekBody(CellularMatrix& matrix, int budget);
+	int collectBody(CellularMatrix& matrix, int budget);
+	int floodBody(CellularMatrix& matrix, int budget);
+	int moveBody(CellularMatrix& matrix, int budget);
+	void beginFlood();
+	void beginMoves();
+	void endPass();
+
+	Phase phase = IDLE;
+	int interval = MIN_INTERVAL;
+	uint64_t nextPass = 0;
+	uint64_t passStart = 0;
+	int passMoved = 0;
+
+	int width = 0;
+	int height = 0;
+
+	std::array<int8_t, ELEMENT_TYPE_COUNT> liquidTypes = [] {
+		std::array<int8_t, ELEMENT_TYPE_COUNT> types {};
+		types.fill(-1); // not looked up yet
+		return types;
+	}();
+
+	// State of the running pass
+	std::vector<SDL_Point> seeds;
+	size_t nextSeed = 0;
+	std::unordered_map<int, std::bitset<g_CHUNK_SIZE * g_CHUNK_SIZE>> seenChunks;
+
+	// State of the current body
+	ElementType bodyType = EMPTY;
+	std::vector<SDL_Point> body;
+	SDL_Point bodyMin {0, 0};
+	SDL_Point bodyMax {0, 0};
+	std::vector<SDL_Point> stack;
+	SDL_Point floodMin {0, 0};
+	SDL_Point floodMax {0, 0};
+	std::vector<std::vector<int>> frontier;
+	int floodRow = 0;
+	size_t filled = 0;
+	SDL_Point nextHole {0, 0};    ///< Scans the flood bottom up
+	SDL_Point nextSource {0, 0};  ///< Scans the flood top down
+
+	int marksX = 0;
+	int marksY = 0;
+	int marksWidth = 0;
+	int marksHeight = 0;
+	std::vector<uint8_t> marks;
+	std::vector<uint8_t> grownMarks;
+};
+
+#endif // LIQUID_LEVELER_HPP
@@ -2,42 +2,110 @@
 #include <SDL2/SDL_ttf.h>
 #include <iostream>
 #include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
 
 #include "src/core/Globals.hpp"
 #include "src/elements/Element.hpp"
 #include "src/elements/ElementFactory.hpp"
 #include "src/core/CellularMatrix.hpp"
 #include "src/core/Renderer.hpp"
+#include "src/core/FrameStats.hpp"
+#include "src/core/LevelImporter.hpp"
 #include "src/particles/ParticleManager.hpp"
 #include "src/ui/ElementUI.hpp"
 #include "src/ui/DebugUI.hpp"
 
+// Cells the view moves per arrow key press
+const static int VIEW_PAN_STEP = 16;
+
 //-------------------------------------------
 // Function Prototypes
 //-------------------------------------------
 bool initializeSDL(SDL_Window*& window, SDL_Renderer*& renderer);
 void handleEvents(bool& running, SDL_Event& event, ElementUI& elementUI, bool& leftMouseDown, bool& rightMouseDown, int& areaSize, CellularMatrix& matrix);
 void handleElementPlacement(CellularMatrix& matrix, int mouseX, int mouseY, bool& leftMouseDown, bool& rightMouseDown, int& prevGridX, int& prevGridY, int areaSize, ElementType selectedElement, bool mouseOverUI);
+int runHeadless(int ticks, int worldWidth, int worldHeight, const LevelImporter* level, bool gasField);
+void importLevel(CellularMatrix& matrix, const LevelImporter& level);
 
 //-------------------------------------------
 // Entry Point
 //-------------------------------------------
-int main() {
+int main(int argc, char* argv[]) {
 	// Load all element types
 	ElementFactory::initialize();
 
+	//-------------------------------------------
+	// Command Line Options
+	//-------------------------------------------
+	// --size <W>x<H>     world size in cells
+	// --scale <N>        window pixels per cell
+	// --headless <ticks> run the simulation without a window and print frame stats
+	// --level <image>    build the world from a level image (sized to it unless --size is given)
+	// --palette <file>   color to element mapping for --level
+	// --gas-field        simulate rising gases on the coarse gas field instead of as cells
+	int worldWidth = Matrix::DEFAULT_WIDTH, worldHeight = Matrix::DEFAULT_HEIGHT;
+	int cellScale = Matrix::DEFAULT_CELL_SCALE;
+	int headlessTicks = 0;
+	bool sizeGiven = false;
+	bool gasField = false;
+	const char* levelPath = nullptr;
+	const char* palettePath = LevelImporter::DEFAULT_PALETTE_PATH;
+	for (int i = 1; i < argc; ++i) {
+		bool hasValue = i + 1 < argc;
+		if (std::strcmp(argv[i], "--size") == 0 && hasValue) {
+			int w = 0, h = 0;
+			if (std::sscanf(argv[++i], "%dx%d", &w, &h) == 2 && w > 0 && h > 0) {
+				worldWidth = w;
+				worldHeight = h;
+				sizeGiven = true;
+			}
+		} else if (std::strcmp(argv[i], "--scale") == 0 && hasValue) {
+			cellScale = std::max(1, std::atoi(argv[++i]));
+		} else if (std::strcmp(argv[i], "--headless") == 0) {
+			headlessTicks = hasValue ? std::atoi(argv[++i]) : 600;
+			if (headlessTicks <= 0) headlessTicks = 600;
+		} else if (std::strcmp(argv[i], "--level") == 0 && hasValue) {
+			levelPath = argv[++i];
+		} else if (std::strcmp(argv[i], "--palette") == 0 && hasValue) {
+			palettePath = argv[++i];
+		} else if (std::strcmp(argv[i], "--gas-field") == 0) {
+			gasField = true;
+		}
+	}
+
+	LevelImporter level;
+	if (levelPath) {
+		if (!level.loadPalette(palettePath) || !level.loadImage(levelPath)) {
+			return -1;
+		}
+		if (!sizeGiven) {
+			worldWidth = level.getImageWidth();
+			worldHeight = level.getImageHeight();
+		}
+	}
+	if (headlessTicks > 0) {
+		return runHeadless(headlessTicks, worldWidth, worldHeight, levelPath ? &level : nullptr, gasField);
+	}
+
 	// Initialize the global renderer pointer before using it
 	g_Renderer = new Renderer();
 
-	if (!g_Renderer->initialize("Falling Sand Simulation")) {
+	if (!g_Renderer->initialize("Falling Sand Simulation", worldWidth, worldHeight, cellScale)) {
 		std::cerr << "Renderer init failed\n";
 		return -1;
 	}
 	g_Renderer->setLogicalResolution();
 
 	// Initialize simulation
-	CellularMatrix matrix(Matrix::WIDTH, Matrix::HEIGHT);
-	matrix.initializeTexture(g_Renderer->getRenderer());
+	CellularMatrix matrix(worldWidth, worldHeight);
+	matrix.setGasFieldEnabled(gasField);
+	if (levelPath) {
+		importLevel(matrix, level);
+	}
+	matrix.initializeTexture(g_Renderer->getRenderer(), g_Renderer->getViewWidth(), g_Renderer->getViewHeight());
 
 	//-------------------------------------------
 	// Simulation State Variables
@@ -49,11 +117,14 @@ int main() {
 	SDL_Event event;
 	Uint32 currentTime = SDL_GetTicks(), previousTime = currentTime;
 	float lag = 0;
+	FrameStats frameStats;
 
 	//-------------------------------------------
 	// Main Loop
 	//-------------------------------------------
 	while (running) {
+		double frameStart = FrameStats::now();
+
 		// Fixed timestep time tracking
 		currentTime = SDL_GetTicks();
 		float elapsed = currentTime - previousTime;
@@ -63,11 +134,8 @@ int main() {
 		// Update debug overlay
 		if (matrix.getDebugMode()) {
 			int activeChunks = matrix.getActiveChunkCount();
-			int totalChunks = ((Matrix::WIDTH + g_CHUNK_SIZE - 1) 
-							  / g_CHUNK_SIZE)
-							  * ((Matrix::HEIGHT + g_CHUNK_SIZE - 1)
-							  / g_CHUNK_SIZE);
-			g_Renderer->getDebugUI()->update(currentTime, activeChunks, totalChunks);
+			int totalChunks = matrix.getTotalChunkCount();
+			g_Renderer->getDebugUI()->update(currentTime, activeChunks, totalChunks, frameStats);
 		}
 
 		// Switch to window coordinates for UI/event handling
@@ -91,15 +159,15 @@ int main() {
 		// Determine if mouse is hovering over UI (window coordinates)
 		bool mouseOverUI = g_Renderer->getElementUI()->isMouseOverUI(mouseX, mouseY);
 
-		// For simulation/brush, still use logical coordinates
-		int logicalMouseX = mouseX * Matrix::WIDTH / Window::WIDTH;
-		int logicalMouseY = mouseY * Matrix::HEIGHT / Window::HEIGHT;
+		// For simulation/brush, use world coordinates under the view
+		auto [logicalMouseX, logicalMouseY] = g_Renderer->windowToRenderCoords(mouseX, mouseY);
 
 		// Handle brush placement if mouse is held down
 		handleElementPlacement(matrix, mouseX, mouseY, leftMouseDown, rightMouseDown, prevGridX, prevGridY, areaSize, selectedElement, mouseOverUI);
 
 		// Fixed timestep physics updates
 		while (lag >= g_MS_PER_UPDATE) {
+			ScopedFrameTimer simTimer(frameStats, FrameStats::SIM);
 			matrix.update();
 			lag -= g_MS_PER_UPDATE;
 		}
@@ -107,9 +175,14 @@ int main() {
 		//-------------------------------------------
 		// Rendering
 		//-------------------------------------------
-		g_Renderer->renderScene(matrix, matrix.getDebugMode());
-		g_Renderer->drawBrushOutline(logicalMouseX, logicalMouseY, areaSize, mouseOverUI);
+		{
+			ScopedFrameTimer renderTimer(frameStats, FrameStats::RENDER);
+			g_Renderer->renderScene(matrix, matrix.getDebugMode());
+			g_Renderer->drawBrushOutline(logicalMouseX, logicalMouseY, areaSize, mouseOverUI);
+		}
 		g_Renderer->present();
+
+		frameStats.record(FrameStats::FRAME, static_cast<float>(FrameStats::now() - frameStart));
 	}
 
 	// Cleanup and shutdown
@@ -119,6 +192,46 @@ int main() {
 	return 0;
 }
 
+//-------------------------------------------
+// Headless Run
+//-------------------------------------------
+int runHeadless(int ticks, int worldWidth, int worldHeight, const LevelImporter* level, bool gasField) {
+	CellularMatrix matrix(worldWidth, worldHeight);
+	matrix.setGasFieldEnabled(gasField);
+	FrameStats frameStats;
+
+	// Default benchmark scene: a sand pour into a pool of water, or into the level
+	if (level) {
+		importLevel(matrix, *level);
+	} else {
+		matrix.placeElementsInArea(worldWidth / 2, worldHeight - 20, 20, WATER);
+	}
+	for (int tick = 0; tick < ticks; ++tick) {
+		double frameStart = FrameStats::now();
+		if (tick % 10 == 0) {
+			matrix.placeElementsInArea(worldWidth / 2, 10, 5, SAND);
+		}
+		{
+			ScopedFrameTimer simTimer(frameStats, FrameStats::SIM);
+			matrix.update();
+		}
+		frameStats.record(FrameStats::FRAME, static_cast<float>(FrameStats::now() - frameStart));
+	}
+
+	std::cout << "Headless run: " << ticks << " ticks, " << worldWidth << "x" << worldHeight << " world, "
+			  << matrix.getActiveChunkCount() << " active / " << matrix.getMaterializedChunkCount() << " materialized / "
+			  << matrix.getTotalChunkCount() << " total chunks\n";
+	frameStats.print(std::cout);
+	return 0;
+}
+
+void importLevel(CellularMatrix& matrix, const LevelImporter& level) {
+	double start = FrameStats::now();
+	size_t changedChunks = level.importInto(matrix).size();
+	std::cout << "Imported " << level.getImageWidth() << "x" << level.getImageHeight() << " level into "
+			  << changedChunks << " chunks in " << FrameStats::now() - start << " ms\n";
+}
+
 //-------------------------------------------
 // SDL Initialization
 //-------------------------------------------
@@ -158,6 +271,12 @@ void handleEvents(bool& running, SDL_Event& event, ElementUI& elementUI, bool& l
 		switch (event.key.keysym.sym) {
 			case SDLK_TAB: elementUI.toggleVisibility(); break;
 			case SDLK_F1: matrix.switchDebugMode(); break;
+			case SDLK_F2: matrix.cycleHeatmapMode(); break;
+			case SDLK_F3: matrix.setGasFieldEnabled(!matrix.isGasFieldEnabled()); break;
+			case SDLK_LEFT:  g_Renderer->panView(-VIEW_PAN_STEP, 0); break;
+			case SDLK_RIGHT: g_Renderer->panView(VIEW_PAN_STEP, 0); break;
+			case SDLK_UP:    g_Renderer->panView(0, -VIEW_PAN_STEP); break;
+			case SDLK_DOWN:  g_Renderer->panView(0, VIEW_PAN_STEP); break;
 		}
 	}
 	else if (event.type == SDL_MOUSEWHEEL) {
@@ -176,24 +295,14 @@ void handleElementPlacement(CellularMatrix& matrix, int mouseX, int mouseY, bool
 	}
 
 	// Convert mouse to grid coords
-	int gridX = mouseX * Matrix::WIDTH / Window::WIDTH;
-	int gridY = mouseY * Matrix::HEIGHT / Window::HEIGHT;
-	if (gridX < 0 || gridX >= Matrix::WIDTH || gridY < 0 || gridY >= Matrix::HEIGHT) return;
-
-	// Always place at current mouse position
-	matrix.placeElementsInArea(gridX, gridY, areaSize, leftMouseDown ? selectedElement : EMPTY);
-
-	// Interpolate between frames to prevent brush skipping on fast movement
-	if (prevGridX != -1 && prevGridY != -1) {
-		int dx = gridX - prevGridX;
-		int dy = gridY - prevGridY;
-		int steps = std::max(std::abs(dx), std::abs(dy));
-		for (int i = 1; i <= steps; ++i) {
-			int interpX = prevGridX + dx * i / steps;
-			int interpY = prevGridY + dy * i / steps;
-			matrix.placeElementsInArea(interpX, interpY, areaSize, leftMouseDown ? selectedElement : EMPTY);
-		}
-	}
+	auto [gridX, gridY] = g_Renderer->windowToRenderCoords(mouseX, mouseY);
+	if (!matrix.isInBounds(gridX, gridY)) return;
+
+	// Paint the whole stroke since the last frame at once, so fast movement
+	// leaves no gaps and overlapping brush circles touch each cell only once
+	bool continuing = prevGridX != -1 && prevGridY != -1;
+	matrix.placeElementsAlongStroke(continuing ? prevGridX : gridX, continuing ? prevGridY : gridY,
+									gridX, gridY, areaSize, leftMouseDown ? selectedElement : EMPTY);
 
 	prevGridX = gridX;
 	prevGridY = gridY;
@@ -1,5 +1,6 @@
 // src/core/Renderer.cpp
 #include "Renderer.hpp"
+#include <algorithm>
 
 // Global pointer to the main renderer instance
 Renderer* g_Renderer = nullptr;
@@ -12,7 +13,14 @@ Renderer::Renderer()
 	: mp_ElementUI(nullptr), mp_DebugUI(nullptr), mp_LightMap(nullptr)
 {}
 
-bool Renderer::initialize(const char* title) {
+bool Renderer::initialize(const char* title, int worldWidth, int worldHeight, int cellScale) {
+	// The view is the window divided by the cell scale, independent of the world size
+	m_WorldWidth = worldWidth;
+	m_WorldHeight = worldHeight;
+	m_ViewWidth = Window::WIDTH / std::max(1, cellScale);
+	m_ViewHeight = Window::HEIGHT / std::max(1, cellScale);
+	panView(0, 0);
+
 	// Initialize SDL and SDL_ttf
 	if (SDL_Init(SDL_INIT_VIDEO) < 0) {
 		std::cerr << "SDL init failed: " << SDL_GetError() << '\n';
@@ -30,8 +38,8 @@ bool Renderer::initialize(const char* title) {
 	if (!mp_Renderer) return false;
 
 	// Create light map texture and buffer
-	mp_LightMap = SDL_CreateTexture(mp_Renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, Matrix::WIDTH, Matrix::HEIGHT);
-	m_LightBuffer.resize(Matrix::WIDTH * Matrix::HEIGHT * 3, 255); // Default: fully lit (white)
+	mp_LightMap = SDL_CreateTexture(mp_Renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, m_ViewWidth, m_ViewHeight);
+	m_LightBuffer.resize(m_ViewWidth * m_ViewHeight * 3, 255); // Default: fully lit (white)
 
 	// Construct UI overlays with the renderer
 	mp_ElementUI = new ElementUI(mp_Renderer);
@@ -67,8 +75,8 @@ void Renderer::present() {
 }
 
 void Renderer::setLogicalResolution() {
-	// Set logical rendering size to simulation grid size
-	SDL_RenderSetLogicalSize(mp_Renderer, Matrix::WIDTH, Matrix::HEIGHT);
+	// Set logical rendering size to the view size
+	SDL_RenderSetLogicalSize(mp_Renderer, m_ViewWidth, m_ViewHeight);
 }
 
 void Renderer::resetLogicalResolution() {
@@ -81,9 +89,16 @@ void Renderer::renderScene(CellularMatrix& matrix, bool showDebug) {
 	clear();
 
 	// Draw low-res game world
-	matrix.updateTexture();
+	matrix.updateTexture(m_ViewX, m_ViewY);
 	drawTexture(matrix.getTexture());
 
+	// Per-chunk cost heatmap, stretched from chunk resolution over the view
+	if (matrix.getHeatmapMode() != CellularMatrix::HEATMAP_OFF) {
+		matrix.updateHeatmapTexture(m_ViewX, m_ViewY);
+		SDL_Rect heatmapRect = matrix.getHeatmapDstRect(m_ViewX, m_ViewY);
+		drawTexture(matrix.getHeatmapTexture(), &heatmapRect);
+	}
+
 	// Switch to full-res and render overlays
 	resetLogicalResolution();
 	mp_ElementUI->render();
@@ -94,9 +109,9 @@ void Renderer::renderScene(CellularMatrix& matrix, bool showDebug) {
 	setLogicalResolution(); // Restore for next frame
 }
 
-void Renderer::drawTexture(SDL_Texture* texture) {
+void Renderer::drawTexture(SDL_Texture* texture, const SDL_Rect* dst) {
 	// Draw a texture to the renderer
-	SDL_RenderCopy(mp_Renderer, texture, nullptr, nullptr);
+	SDL_RenderCopy(mp_Renderer, texture, nullptr, dst);
 }
 
 //------------------------------------------------------------------------------
@@ -104,40 +119,52 @@ void Renderer::drawTexture(SDL_Texture* texture) {
 //------------------------------------------------------------------------------
 
 void Renderer::drawBrushOutline(int x, int y, int radius, bool mouseOverUI) {
-	// Draw a circular outline for the brush if not over UI and within bounds
-	if (mouseOverUI || x < 0 || x >= Matrix::WIDTH || y < 0 || y >= Matrix::HEIGHT) return;
+	// Draw a circular outline for the brush if not over UI and within the world
+	if (mouseOverUI || x < 0 || x >= m_WorldWidth || y < 0 || y >= m_WorldHeight) return;
 	SDL_SetRenderDrawColor(mp_Renderer, 255, 255, 255, 255);
-	drawCircleOutline(x, y, radius);
+	drawCircleOutline(x - m_ViewX, y - m_ViewY, radius);
 }
 
 void Renderer::drawCircleOutline(int centerX, int centerY, int radius) {
-	// Draw a circle outline using the midpoint circle algorithm
-	const int diameter = radius * 2;
-	int x = radius - 1, y = 0;
-	int tx = 1, ty = 1;
-	int err = tx - diameter;
-
-	while (x >= y) {
-		SDL_RenderDrawPoint(mp_Renderer, centerX + x, centerY - y);
-		SDL_RenderDrawPoint(mp_Renderer, centerX + x, centerY + y);
-		SDL_RenderDrawPoint(mp_Renderer, centerX - x, centerY - y);
-		SDL_RenderDrawPoint(mp_Renderer, centerX - x, centerY + y);
-		SDL_RenderDrawPoint(mp_Renderer, centerX + y, centerY - x);
-		SDL_RenderDrawPoint(mp_Renderer, centerX + y, centerY + x);
-		SDL_RenderDrawPoint(mp_Renderer, centerX - y, centerY - x);
-		SDL_RenderDrawPoint(mp_Renderer, centerX - y, centerY + x);
-
-		if (err <= 0) {
-			y++;
-			err += ty;
-			ty += 2;
-		}
-		if (err > 0) {
-			x--;
-			tx += 2;
-			err += tx - diameter;
+	// Rebuild the outline offsets with the midpoint circle algorithm only when the radius changes
+	if (radius != m_CachedCircleRadius) {
+		m_CachedCircleRadius = radius;
+		m_CircleOffsets.clear();
+
+		const int diameter = radius * 2;
+		int x = radius - 1, y = 0;
+		int tx = 1, ty = 1;
+		int err = tx - diameter;
+
+		while (x >= y) {
+			m_CircleOffsets.push_back({ x, -y });
+			m_CircleOffsets.push_back({ x,  y });
+			m_CircleOffsets.push_back({-x, -y });
+			m_CircleOffsets.push_back({-x,  y });
+			m_CircleOffsets.push_back({ y, -x });
+			m_CircleOffsets.push_back({ y,  x });
+			m_CircleOffsets.push_back({-y, -x });
+			m_CircleOffsets.push_back({-y,  x });
+
+			if (err <= 0) {
+				y++;
+				err += ty;
+				ty += 2;
+			}
+			if (err > 0) {
+				x--;
+				tx += 2;
+				err += tx - diameter;
+			}
 		}
 	}
+
+	// Translate the cached offsets and submit them all at once
+	m_PointBatch.resize(m_CircleOffsets.size());
+	for (size_t i = 0; i < m_CircleOffsets.size(); ++i) {
+		m_PointBatch[i] = { centerX + m_CircleOffsets[i].x, centerY + m_CircleOffsets[i].y };
+	}
+	SDL_RenderDrawPoints(mp_Renderer, m_PointBatch.data(), static_cast<int>(m_PointBatch.size()));
 }
 
 void Renderer::drawScreenSpaceRect(int x, int y, int width, int height, int thickness) {
@@ -153,20 +180,21 @@ void Renderer::drawScreenSpaceRect(int x, int y, int width, int height, int thic
 
 void Renderer::drawQueuedRects() {
 	// Draw all queued screen-space rectangles (used for overlays)
+	if (m_QueuedRects.empty()) return;
+
 	resetLogicalResolution();
 	SDL_SetRenderDrawColor(mp_Renderer, 255, 0, 0, 255); // Red outlines
 
+	// Expand every rect into its four border strips and submit them in one call
+	m_RectBatch.clear();
+	m_RectBatch.reserve(m_QueuedRects.size() * 4);
 	for (const auto& rect : m_QueuedRects) {
-		SDL_Rect top    = { rect.x, rect.y, rect.w, rect.thickness };
-		SDL_Rect bottom = { rect.x, rect.y + rect.h - rect.thickness, rect.w, rect.thickness };
-		SDL_Rect left   = { rect.x, rect.y, rect.thickness, rect.h };
-		SDL_Rect right  = { rect.x + rect.w - rect.thickness, rect.y, rect.thickness, rect.h };
-
-		SDL_RenderFillRect(mp_Renderer, &top);
-		SDL_RenderFillRect(mp_Renderer, &bottom);
-		SDL_RenderFillRect(mp_Renderer, &left);
-		SDL_RenderFillRect(mp_Renderer, &right);
+		m_RectBatch.push_back({ rect.x, rect.y, rect.w, rect.thickness });                          // top
+		m_RectBatch.push_back({ rect.x, rect.y + rect.h - rect.thickness, rect.w, rect.thickness }); // bottom
+		m_RectBatch.push_back({ rect.x, rect.y, rect.thickness, rect.h });                          // left
+		m_RectBatch.push_back({ rect.x + rect.w - rect.thickness, rect.y, rect.thickness, rect.h }); // right
 	}
+	SDL_RenderFillRects(mp_Renderer, m_RectBatch.data(), static_cast<int>(m_RectBatch.size()));
 
 	m_QueuedRects.clear();
 	setLogicalResolution();
@@ -177,19 +205,25 @@ void Renderer::drawQueuedRects() {
 //------------------------------------------------------------------------------
 
 std::pair<int, int> Renderer::windowToRenderCoords(int winX, int winY) const {
-	// Convert window (screen) coordinates to simulation (render) coordinates
-	int renderX = winX * Matrix::WIDTH / Window::WIDTH;
-	int renderY = winY * Matrix::HEIGHT / Window::HEIGHT;
+	// Convert window (screen) coordinates to simulation (world) coordinates
+	int renderX = m_ViewX + winX * m_ViewWidth / Window::WIDTH;
+	int renderY = m_ViewY + winY * m_ViewHeight / Window::HEIGHT;
 	return { renderX, renderY };
 }
 
 std::pair<int, int> Renderer::renderToWindowCoords(int renderX, int renderY) const {
-	// Convert simulation (render) coordinates to window (screen) coordinates
-	int winX = renderX * Window::WIDTH / Matrix::WIDTH;
-	int winY = renderY * Window::HEIGHT / Matrix::HEIGHT;
+	// Convert simulation (world) coordinates to window (screen) coordinates
+	int winX = (renderX - m_ViewX) * Window::WIDTH / m_ViewWidth;
+	int winY = (renderY - m_ViewY) * Window::HEIGHT / m_ViewHeight;
 	return { winX, winY };
 }
 
+void Renderer::panView(int dx, int dy) {
+	// Keep the view inside the world; worlds smaller than the view stay pinned at the origin
+	m_ViewX = std::clamp(m_ViewX + dx, 0, std::max(0, m_WorldWidth - m_ViewWidth));
+	m_ViewY = std::clamp(m_ViewY + dy, 0, std::max(0, m_WorldHeight - m_ViewHeight));
+}
+
 //------------------------------------------------------------------------------
 // Accessors
 //------------------------------------------------------------------------------
@@ -14,6 +14,8 @@
  * 
  * Manages SDL window, renderer, logical resolution, UI overlays, and debug overlays.
  * Provides utility functions for drawing textures, brush outlines, and screen-space rectangles.
+ * The window shows a view into the world whose size is the window size divided by the
+ * cell scale; the view can be panned over worlds larger than the window.
  */
 class Renderer {
 public:
@@ -25,9 +27,12 @@ public:
 	/**
 	 * @brief Initialize SDL, create window and renderer, and initialize UI overlays.
 	 * @param title Window title
+	 * @param worldWidth World width in cells
+	 * @param worldHeight World height in cells
+	 * @param cellScale Window pixels per cell
 	 * @return true on success, false on failure
 	 */
-	bool initialize(const char* title);
+	bool initialize(const char* title, int worldWidth, int worldHeight, int cellScale = Matrix::DEFAULT_CELL_SCALE);
 
 	/**
 	 * @brief Clear the screen to black.
@@ -40,7 +45,7 @@ public:
 	void present();
 
 	/**
-	 * @brief Set SDL logical rendering size to simulation grid size.
+	 * @brief Set SDL logical rendering size to the view size (in cells).
 	 */
 	void setLogicalResolution();
 
@@ -52,13 +57,14 @@ public:
 	/**
 	 * @brief Draw a texture to the renderer.
 	 * @param texture SDL_Texture to draw
+	 * @param dst Destination rect in logical coordinates, or nullptr to fill the view
 	 */
-	void drawTexture(SDL_Texture* texture);
+	void drawTexture(SDL_Texture* texture, const SDL_Rect* dst = nullptr);
 
 	/**
 	 * @brief Draw a circular outline for the brush at the given position.
-	 * @param mouseX X position in simulation coordinates
-	 * @param mouseY Y position in simulation coordinates
+	 * @param mouseX X position in world coordinates
+	 * @param mouseY Y position in world coordinates
 	 * @param radius Brush radius
 	 * @param mouseOverUI If true, do not draw the outline
 	 */
@@ -66,10 +72,10 @@ public:
 
 	/**
 	 * @brief Draw a rectangle in screen (window) space with a given thickness.
-	 * @param x Top-left X in simulation coordinates
-	 * @param y Top-left Y in simulation coordinates
-	 * @param width Width in simulation coordinates
-	 * @param height Height in simulation coordinates
+	 * @param x Top-left X in world coordinates
+	 * @param y Top-left Y in world coordinates
+	 * @param width Width in cells
+	 * @param height Height in cells
 	 * @param thickness Border thickness in pixels
 	 */
 	void drawScreenSpaceRect(int x, int y, int width, int height, int thickness);
@@ -102,7 +108,7 @@ public:
 	void cleanup();
 
 	/**
-	 * @brief Convert window (screen) coordinates to simulation (render) coordinates.
+	 * @brief Convert window (screen) coordinates to simulation (world) coordinates.
 	 * @param winX Window X
 	 * @param winY Window Y
 	 * @return Pair of (renderX, renderY)
@@ -110,13 +116,26 @@ public:
 	std::pair<int, int> windowToRenderCoords(int winX, int winY) const;
 
 	/**
-	 * @brief Convert simulation (render) coordinates to window (screen) coordinates.
+	 * @brief Convert simulation (world) coordinates to window (screen) coordinates.
 	 * @param renderX Simulation X
 	 * @param renderY Simulation Y
 	 * @return Pair of (winX, winY)
 	 */
 	std::pair<int, int> renderToWindowCoords(int renderX, int renderY) const;
 
+	/**
+	 * @brief Move the view by a number of cells, clamped to the world.
+	 * @param dx Cells to move right
+	 * @param dy Cells to move down
+	 */
+	void panView(int dx, int dy);
+
+	// View (camera) accessors, in world cells
+	int getViewX() const { return m_ViewX; }
+	int getViewY() const { return m_ViewY; }
+	int getViewWidth() const { return m_ViewWidth; }
+	int getViewHeight() const { return m_ViewHeight; }
+
 private:
 	// SDL window and renderer
 	SDL_Window* mp_Window = nullptr;
@@ -126,6 +145,14 @@ private:
 	ElementUI* mp_ElementUI = nullptr;
 	DebugUI* mp_DebugUI = nullptr;
 
+	// World and view (camera) dimensions, in cells
+	int m_WorldWidth = Matrix::DEFAULT_WIDTH;
+	int m_WorldHeight = Matrix::DEFAULT_HEIGHT;
+	int m_ViewX = 0;
+	int m_ViewY = 0;
+	int m_ViewWidth = Matrix::DEFAULT_WIDTH;
+	int m_ViewHeight = Matrix::DEFAULT_HEIGHT;
+
 	// Utility font pointer (not used directly in Renderer, but may be used by overlays)
 	TTF_Font* mp_Font {nullptr};
 
@@ -134,10 +161,16 @@ private:
 		int x, y, w, h, thickness;
 	};
 	std::vector<ScreenRect> m_QueuedRects;
+	std::vector<SDL_Rect> m_RectBatch;      ///< Border strips of all queued rects, drawn in one call
+
+	// Brush outline cache: offsets are rebuilt only when the radius changes
+	int m_CachedCircleRadius = -1;
+	std::vector<SDL_Point> m_CircleOffsets;
+	std::vector<SDL_Point> m_PointBatch;
 
 	// Lighting system
 	SDL_Texture* mp_LightMap = nullptr;
-	// Change to store RGB for each cell (3 bytes per cell)
+	// Change to store RGB for each cell in view (3 bytes per cell)
 	std::vector<uint8_t> m_LightBuffer; // R, G, B per cell
 
 	struct PointLight {
@@ -148,12 +181,12 @@ private:
 	std::vector<PointLight> m_PointLights;
 
 	/**
-	 * @brief Draw all queued screen-space rectangles (used for overlays).
+	 * @brief Draw all queued screen-space rectangles (used for overlays) in a single batched call.
 	 */
 	void drawQueuedRects();
 
 	/**
-	 * @brief Draw a circle outline using integer coordinates.
+	 * @brief Draw a circle outline using integer coordinates, batched into one point call.
 	 * @param centerX Center X
 	 * @param centerY Center Y
 	 * @param radius Radius
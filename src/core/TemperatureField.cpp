@@ -0,0 +1,286 @@
+// src/core/TemperatureField.cpp
+#include "src/core/TemperatureField.hpp"
+#include "src/core/CellularMatrix.hpp"
+#include "src/elements/PhaseTransitions.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+void TemperatureField::resize(int worldWidth, int worldHeight) {
+	width = worldWidth;
+	height = worldHeight;
+	chunksX = (width + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
+	chunksY = (height + g_CHUNK_SIZE - 1) / g_CHUNK_SIZE;
+	temperatures.clear();
+	warm.assign(static_cast<size_t>(chunksX) * chunksY, 0);
+	warmChunks.clear();
+}
+
+void TemperatureField::allocate() {
+	temperatures.assign(static_cast<size_t>(width) * height, AMBIENT);
+}
+
+void TemperatureField::markWarm(int chunkX, int chunkY) {
+	uint8_t& flag = warm[static_cast<size_t>(chunkY) * chunksX + chunkX];
+	if (!flag) {
+		flag = 1;
+		warmChunks.push_back({chunkX, chunkY});
+	}
+}
+
+//-------------------------------------------
+// Cell Access
+//-------------------------------------------
+float TemperatureField::getTemperature(int x, int y) const {
+	return isAllocated() ? temperatures[cellIndex(x, y)] : AMBIENT;
+}
+
+void TemperatureField::setTemperature(int x, int y, float temperature) {
+	if (!isAllocated()) {
+		if (temperature == AMBIENT) return;
+		allocate();
+	}
+	temperatures[cellIndex(x, y)] = temperature;
+	markWarm(x / g_CHUNK_SIZE, y / g_CHUNK_SIZE);
+}
+
+void TemperatureField::swapCells(int x1, int y1, int x2, int y2) {
+	if (!isAllocated()) return;
+	float& first = temperatures[cellIndex(x1, y1)];
+	float& second = temperatures[cellIndex(x2, y2)];
+	if (first == second) return;
+	std::swap(first, second);
+	markWarm(x1 / g_CHUNK_SIZE, y1 / g_CHUNK_SIZE);
+	markWarm(x2 / g_CHUNK_SIZE, y2 / g_CHUNK_SIZE);
+}
+
+void TemperatureField::shiftColumnDown(int x, int topY, int bottomY, int distance) {
+	if (!isAllocated() || distance <= 0 || topY > bottomY) return;
+
+	// Same rotation as the cells: the run moves down, what was below it moves up
+	bool anyWarm = false;
+	displaced.clear();
+	for (int y = bottomY + 1; y <= bottomY + distance; ++y) {
+		displaced.push_back(temperatures[cellIndex(x, y)]);
+	}
+	for (int y = bottomY; y >= topY; --y) {
+		float temperature = temperatures[cellIndex(x, y)];
+		anyWarm |= temperature != AMBIENT;
+		temperatures[cellIndex(x, y + distance)] = temperature;
+	}
+	for (int i = 0; i < distance; ++i) {
+		anyWarm |= displaced[i] != AMBIENT;
+		temperatures[cellIndex(x, topY + i)] = displaced[i];
+	}
+
+	if (anyWarm) {
+		for (int chunkY = topY / g_CHUNK_SIZE; chunkY <= (bottomY + distance) / g_CHUNK_SIZE; ++chunkY) {
+			markWarm(x / g_CHUNK_SIZE, chunkY);
+		}
+	}
+}
+
+//-------------------------------------------
+// Conduction
+//-------------------------------------------
+void TemperatureField::update(CellularMatrix& matrix) {
+	if (warmChunks.empty()) return;
+
+	// Heat at the edge of a warm chunk flows into its neighbor on this tick already
+	static constexpr int DIRECTIONS[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+	size_t stepCount = warmChunks.size();
+	for (size_t i = 0; i < stepCount; ++i) {
+		SDL_Point chunk = warmChunks[i];
+		for (const auto& direction : DIRECTIONS) {
+			int chunkX = chunk.x + direction[0];
+			int chunkY = chunk.y + direction[1];
+			if (chunkX < 0 || chunkX >= chunksX || chunkY < 0 || chunkY >= chunksY) continue;
+			if (!warm[static_cast<size_t>(chunkY) * chunksX + chunkX] && isEdgeWarm(chunk, direction[0], direction[1])) {
+				markWarm(chunkX, chunkY);
+			}
+		}
+	}
+
+	// Step every warm chunk from the old temperatures before writing any back
+	stepCount = warmChunks.size();
+	size_t scratchSize = stepCount * Chunk::CELL_COUNT;
+	stepped.resize(scratchSize);
+	steppedTypes.resize(scratchSize);
+	steppedHeating.resize(scratchSize);
+	steppedCooling.resize(scratchSize);
+	for (size_t i = 0; i < stepCount; ++i) {
+		stepChunk(matrix, warmChunks[i], i);
+	}
+
+	// Write back and retire chunks that cooled off
+	size_t kept = 0;
+	for (size_t i = 0; i < stepCount; ++i) {
+		SDL_Point chunk = warmChunks[i];
+		if (applyChunk(chunk, i)) {
+			warmChunks[kept++] = chunk;
+		} else {
+			warm[static_cast<size_t>(chunk.y) * chunksX + chunk.x] = 0;
+		}
+	}
+	warmChunks.resize(kept);
+
+	// All transitions of the tick, one bulk placement per target type. Turning
+	// into FIRE is igniting, so the cell burns as the fuel it was.
+	for (ElementType target : transitionTargets) {
+		if (target == FIRE) {
+			matrix.igniteSpans(transitionSpans[target]);
+		} else {
+			matrix.placeElementsInSpans(transitionSpans[target], target);
+		}
+		transitionSpans[target].clear();
+	}
+	transitionTargets.clear();
+}
+
+bool TemperatureField::isEdgeWarm(SDL_Point chunk, int dx, int dy) const {
+	int startX = chunk.x * g_CHUNK_SIZE;
+	int startY = chunk.y * g_CHUNK_SIZE;
+	int endX = std::min(startX + g_CHUNK_SIZE, width) - 1;
+	int endY = std::min(startY + g_CHUNK_SIZE, height) - 1;
+	if (dx != 0) {
+		int x = dx < 0 ? startX : endX;
+		for (int y = startY; y <= endY; ++y) {
+			if (std::abs(temperatures[cellIndex(x, y)] - AMBIENT) > SETTLE_DELTA) return true;
+		}
+	} else {
+		int y = dy < 0 ? startY : endY;
+		for (int x = startX; x <= endX; ++x) {
+			if (std::abs(temperatures[cellIndex(x, y)] - AMBIENT) > SETTLE_DELTA) return true;
+		}
+	}
+	return false;
+}
+
+void TemperatureField::stepChunk(const CellularMatrix& matrix, SDL_Point chunk, size_t slot) {
+	int startX = chunk.x * g_CHUNK_SIZE;
+	int startY = chunk.y * g_CHUNK_SIZE;
+	float* out = &stepped[slot * Chunk::CELL_COUNT];
+	ElementType* types = &steppedTypes[slot * Chunk::CELL_COUNT];
+	float* heating = &steppedHeating[slot * Chunk::CELL_COUNT];
+	float* cooling = &steppedCooling[slot * Chunk::CELL_COUNT];
+
+	// Gather the chunk and a one-cell ring; cells outside the world conduct nothing
+	for (int row = 0; row < TILE_SIDE; ++row) {
+		int y = startY + row - 1;
+		for (int col = 0; col < TILE_SIDE; ++col) {
+			int x = startX + col - 1;
+			int tile = row * TILE_SIDE + col;
+			if (matrix.isInBounds(x, y)) {
+				const Element* element = matrix.getElement(x, y);
+				tileTemperature[tile] = temperatures[cellIndex(x, y)];
+				tileConductivity[tile] = element->getProperties().conductivity;
+				if (row > 0 && row <= g_CHUNK_SIZE && col > 0 && col <= g_CHUNK_SIZE) {
+					int local = (row - 1) * g_CHUNK_SIZE + col - 1;
+					ElementType type = element->getType();
+					types[local] = type;
+					heating[local] = PHASE_TRANSITION_LOOKUP.heatingThreshold[type];
+					// Cooling only counts from at or above the threshold, so cells that
+					// were placed already below it (brushed steam) keep their type
+					float coolingThreshold = PHASE_TRANSITION_LOOKUP.coolingThreshold[type];
+					cooling[local] = tileTemperature[tile] >= coolingThreshold ? coolingThreshold : -std::numeric_limits<float>::infinity();
+				}
+			} else {
+				tileTemperature[tile] = AMBIENT;
+				tileConductivity[tile] = 0.0f;
+				if (row > 0 && row <= g_CHUNK_SIZE && col > 0 && col <= g_CHUNK_SIZE) {
+					int local = (row - 1) * g_CHUNK_SIZE + col - 1;
+					types[local] = EMPTY;
+					heating[local] = PHASE_TRANSITION_LOOKUP.heatingThreshold[EMPTY];
+					cooling[local] = PHASE_TRANSITION_LOOKUP.coolingThreshold[EMPTY];
+				}
+			}
+		}
+	}
+
+	// Each pair of cells exchanges through the lower conductivity of the two,
+	// so the heat one cell loses the other gains
+	const float* t = tileTemperature.data();
+	const float* k = tileConductivity.data();
+	for (int row = 1; row <= g_CHUNK_SIZE; ++row) {
+		float* outRow = out + (row - 1) * g_CHUNK_SIZE;
+		for (int col = 1; col <= g_CHUNK_SIZE; ++col) {
+			int i = row * TILE_SIDE + col;
+			float flux = std::min(k[i], k[i - 1]) * (t[i - 1] - t[i]) +
+						 std::min(k[i], k[i + 1]) * (t[i + 1] - t[i]) +
+						 std::min(k[i], k[i - TILE_SIDE]) * (t[i - TILE_SIDE] - t[i]) +
+						 std::min(k[i], k[i + TILE_SIDE]) * (t[i + TILE_SIDE] - t[i]);
+			outRow[col - 1] = t[i] + flux + AMBIENT_LOSS * (AMBIENT - t[i]);
+		}
+	}
+}
+
+bool TemperatureField::applyChunk(SDL_Point chunk, size_t slot) {
+	int startX = chunk.x * g_CHUNK_SIZE;
+	int startY = chunk.y * g_CHUNK_SIZE;
+	int endX = std::min(startX + g_CHUNK_SIZE, width);
+	int endY = std::min(startY + g_CHUNK_SIZE, height);
+	const float* values = &stepped[slot * Chunk::CELL_COUNT];
+	const ElementType* types = &steppedTypes[slot * Chunk::CELL_COUNT];
+	const float* heating = &steppedHeating[slot * Chunk::CELL_COUNT];
+	const float* cooling = &steppedCooling[slot * Chunk::CELL_COUNT];
+
+	// Compare the whole chunk against its thresholds first; cells outside the
+	// world have EMPTY's, which no temperature crosses
+	std::array<uint8_t, Chunk::CELL_COUNT> crossed;
+	bool anyCrossed = false;
+	for (int local = 0; local < Chunk::CELL_COUNT; ++local) {
+		crossed[local] = (values[local] >= heating[local]) | (values[local] < cooling[local]);
+		anyCrossed |= crossed[local];
+	}
+
+	bool stillWarm = false;
+	for (int y = startY; y < endY; ++y) {
+		const float* row = values + (y - startY) * g_CHUNK_SIZE;
+		std::copy(row, row + (endX - startX), &temperatures[cellIndex(startX, y)]);
+		for (int x = startX; x < endX; ++x) {
+			stillWarm |= std::abs(row[x - startX] - AMBIENT) > SETTLE_DELTA;
+		}
+	}
+
+	// Runs of crossing cells with the same outcome become one span
+	if (anyCrossed) {
+		for (int y = startY; y < endY; ++y) {
+			int runStart = -1;
+			ElementType runTarget = EMPTY;
+			for (int x = startX; x <= endX; ++x) {
+				int local = (y - startY) * g_CHUNK_SIZE + (x - startX);
+				bool inRun = x < endX && crossed[local];
+				ElementType target = EMPTY;
+				if (inRun) {
+					ElementType type = types[local];
+					target = values[local] >= heating[local] ? PHASE_TRANSITION_LOOKUP.heatingTarget[type]
+															 : PHASE_TRANSITION_LOOKUP.coolingTarget[type];
+				}
+				if (runStart >= 0 && (!inRun || target != runTarget)) {
+					queueTransition(y, runStart, x - 1, runTarget);
+					runStart = -1;
+				}
+				if (inRun && runStart < 0) {
+					runStart = x;
+					runTarget = target;
+				}
+			}
+		}
+	}
+
+	// Back at ambient; the leftover fractions of a degree are dropped
+	if (!stillWarm) {
+		for (int y = startY; y < endY; ++y) {
+			std::fill_n(&temperatures[cellIndex(startX, y)], endX - startX, AMBIENT);
+		}
+	}
+	return stillWarm;
+}
+
+void TemperatureField::queueTransition(int y, int x0, int x1, ElementType target) {
+	std::vector<CellSpan>& spans = transitionSpans[target];
+	if (spans.empty()) {
+		transitionTargets.push_back(target);
+	}
+	spans.push_back({y, x0, x1});
+}
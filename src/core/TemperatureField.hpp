@@ -0,0 +1,104 @@
+// src/core/TemperatureField.hpp
+#ifndef TEMPERATURE_FIELD_HPP
+#define TEMPERATURE_FIELD_HPP
+
+#include "src/core/Globals.hpp"
+#include "src/core/BrushStroke.hpp"
+#include "src/elements/Element.hpp"
+#include <SDL2/SDL.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Per-cell temperatures and the heat conducted between them.
+ *
+ * Temperatures are kept apart from the elements, in a world-sized float grid
+ * allocated the first time anything is heated. Every tick each pair of
+ * neighboring cells exchanges heat in proportion to the lower conductivity of
+ * their two types, computed with a branch-free stencil one chunk at a time,
+ * and every cell leaks a little toward AMBIENT. Only warm chunks, those with
+ * cells away from ambient, are stepped; a chunk drops off once all its cells
+ * are back at ambient. Temperatures travel with the elements as they move.
+ *
+ * After conducting, the new temperatures of the warm chunks are compared
+ * against the PHASE_TRANSITIONS thresholds of their cells' types; a cooling
+ * transition needs the cell to drop below its threshold on this tick. The cells
+ * that crossed one are gathered into spans per target type and replaced in one
+ * batch through CellularMatrix::placeElementsInSpans, so each affected chunk
+ * is materialized and woken once.
+ */
+class TemperatureField {
+public:
+	static constexpr float AMBIENT = 20.0f;
+	static constexpr float AMBIENT_LOSS = 0.002f;  ///< Share of the difference to ambient lost per tick
+	static constexpr float SETTLE_DELTA = 0.5f;    ///< Chunks this close to ambient everywhere cool off
+
+	/**
+	 * @brief Size the field for a world, back at ambient everywhere.
+	 */
+	void resize(int worldWidth, int worldHeight);
+
+	float getTemperature(int x, int y) const;
+	void setTemperature(int x, int y, float temperature);
+
+	/**
+	 * @brief Move temperatures along with elements; mirror the matrix operations
+	 * of the same name.
+	 */
+	void swapCells(int x1, int y1, int x2, int y2);
+	void shiftColumnDown(int x, int topY, int bottomY, int distance);
+
+	/**
+	 * @brief Conduct heat for one tick and apply the phase transitions it causes.
+	 * @param matrix World whose element types set the conductivities and
+	 * thresholds, and whose cells are transformed
+	 */
+	void update(CellularMatrix& matrix);
+
+	size_t getWarmChunkCount() const { return warmChunks.size(); }
+
+private:
+	static constexpr int TILE_SIDE = g_CHUNK_SIZE + 2; ///< A chunk and a ring of its neighbors' cells
+
+	size_t cellIndex(int x, int y) const { return static_cast<size_t>(y) * width + x; }
+	bool isAllocated() const { return !temperatures.empty(); }
+	void allocate();
+	void markWarm(int chunkX, int chunkY);
+
+	// Whether heat at the edge of a warm chunk reaches into the neighbor at (dx, dy)
+	bool isEdgeWarm(SDL_Point chunk, int dx, int dy) const;
+	// Steps the chunk at slot into the step scratch
+	void stepChunk(const CellularMatrix& matrix, SDL_Point chunk, size_t slot);
+	// Writes the chunk at slot back, queues its transitions and returns whether it is still warm
+	bool applyChunk(SDL_Point chunk, size_t slot);
+	void queueTransition(int y, int x0, int x1, ElementType target);
+
+	int width = 0;
+	int height = 0;
+	int chunksX = 0;
+	int chunksY = 0;
+
+	// Per cell, empty until first used
+	std::vector<float> temperatures;
+
+	// Chunks being stepped, and a per-chunk flag for membership
+	std::vector<SDL_Point> warmChunks;
+	std::vector<uint8_t> warm;
+
+	// Step scratch, CELL_COUNT entries per warm chunk: new temperatures, and the
+	// types and transition thresholds of the cells
+	std::vector<float> stepped;
+	std::vector<ElementType> steppedTypes;
+	std::vector<float> steppedHeating;
+	std::vector<float> steppedCooling;
+	std::array<float, TILE_SIDE * TILE_SIDE> tileTemperature {};
+	std::array<float, TILE_SIDE * TILE_SIDE> tileConductivity {};
+	std::vector<float> displaced;
+
+	// Transitions of the current tick, as spans per target type
+	std::array<std::vector<CellSpan>, ELEMENT_TYPE_COUNT> transitionSpans;
+	std::vector<ElementType> transitionTargets;
+};
+
+#endif // TEMPERATURE_FIELD_HPP
@@ -0,0 +1,39 @@
+// src/core/TimerWheel.cpp
+#include "src/core/TimerWheel.hpp"
+
+void TimerWheel::schedule(uint64_t tick, int x, int y) {
+	place({tick < currentTick ? currentTick : tick, x, y});
+	++eventCount;
+}
+
+void TimerWheel::place(const Event& event) {
+	// The coarsest level whose span still has to be waited out
+	uint64_t delay = event.tick - currentTick;
+	int level = 0;
+	while (level < LEVEL_COUNT - 1 && delay >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+		++level;
+	}
+	int slot = static_cast<int>((event.tick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1));
+	levels[level][slot].push_back(event);
+}
+
+void TimerWheel::advance(std::vector<Event>& due) {
+	// Whenever a level wraps, the next coarser slot comes up and is spread
+	// over the finer levels
+	for (int level = 1; level < LEVEL_COUNT; ++level) {
+		uint64_t finerMask = (uint64_t(1) << (SLOT_BITS * level)) - 1;
+		if ((currentTick & finerMask) != 0) break;
+
+		int slot = static_cast<int>((currentTick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1));
+		cascade.clear();
+		cascade.swap(levels[level][slot]);
+		for (const Event& event : cascade) {
+			place(event);
+		}
+	}
+
+	due.clear();
+	due.swap(levels[0][currentTick & (SLOT_COUNT - 1)]);
+	eventCount -= due.size();
+	++currentTick;
+}
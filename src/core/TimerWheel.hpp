@@ -0,0 +1,64 @@
+// src/core/TimerWheel.hpp
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Hierarchical timer wheel of cell wake-ups.
+ *
+ * An event asks for the cell at (x, y) to be woken on a given simulation
+ * tick; whatever is there then decides what to do, so events never point at
+ * elements that may have moved or been deleted. Each level has SLOT_COUNT
+ * slots, level 0 one tick per slot and every further level SLOT_COUNT times
+ * coarser. Events in coarser levels are moved down as their slot comes up,
+ * so scheduling and firing are O(1) per event whatever the delay.
+ */
+class TimerWheel {
+public:
+	struct Event {
+		uint64_t tick;
+		int x;
+		int y;
+	};
+
+	static constexpr int SLOT_BITS = 6;
+	static constexpr int SLOT_COUNT = 1 << SLOT_BITS;
+	static constexpr int LEVEL_COUNT = 4;  ///< Delays up to 2^24 ticks without a cascade overflow
+
+	/**
+	 * @brief Schedule a wake-up of (x, y) at the given tick.
+	 *
+	 * Ticks that already passed fire with the next advance.
+	 */
+	void schedule(uint64_t tick, int x, int y);
+
+	/**
+	 * @brief Fire the events of the current tick and move to the next one.
+	 * @param due Receives the fired events (cleared first)
+	 */
+	void advance(std::vector<Event>& due);
+
+	/**
+	 * @brief The tick the next advance fires.
+	 */
+	uint64_t getCurrentTick() const { return currentTick; }
+
+	/**
+	 * @brief Number of scheduled events.
+	 */
+	size_t size() const { return eventCount; }
+
+private:
+	void place(const Event& event);
+
+	std::array<std::array<std::vector<Event>, SLOT_COUNT>, LEVEL_COUNT> levels;
+	std::vector<Event> cascade;  ///< Scratch for events moved down a level
+	uint64_t currentTick = 0;
+	size_t eventCount = 0;
+};
+
+#endif // TIMER_WHEEL_HPP
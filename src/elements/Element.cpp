@@ -1,5 +1,6 @@
 // src/elements/Element.cpp
 #include "src/elements/Element.hpp"
+#include "src/core/CellularMatrix.hpp"
 
 bool Element::s_Step = false;
 
@@ -14,7 +15,6 @@ Element::Element(ElementType type, int x, int y)
 {}
 
 // ========= Element Metadata =========
-ElementType Element::getType() const { return m_Type; }
 std::string Element::getTypeString() const { return ElementFactory::getElementName(m_Type); }
 SDL_Color Element::getColor() const { return m_Color; }
 void Element::setColor(const SDL_Color& newColor) { m_Color = newColor; }
@@ -26,7 +26,7 @@ void Element::setAsUpdated() { m_Step = Element::s_Step; }
 // ========= Positional Properties =========
 int Element::getPosX() const { return m_PosX; }
 int Element::getPosY() const { return m_PosY; }
-void Element::setPosition(int x, int y) { m_PosX = x; m_PosY = y; }
+void Element::setPosition(int x, int y) { m_PosX = x; m_PosY = y; setReaction(NO_TICK, 0.0f); }
 
 // ========= Update State =========
 bool Element::checkIfUpdated() {
@@ -36,10 +36,17 @@ bool Element::checkIfUpdated() {
 }
 
 // ========= Element Management =========
-void Element::destroyElement(IMatrix& matrix, int x, int y) {
+template<typename TMatrix>
+void Element::destroyElement(TMatrix& matrix, int x, int y) {
 	matrix.destroyElement(x, y);
 }
 
-void Element::destroySelf(IMatrix& matrix) {
+template<typename TMatrix>
+void Element::destroySelf(TMatrix& matrix) {
 	matrix.destroyElement(m_PosX, m_PosY);
-}
\ No newline at end of file
+}
+
+template void Element::destroyElement<IMatrix>(IMatrix&, int, int);
+template void Element::destroyElement<CellularMatrix>(CellularMatrix&, int, int);
+template void Element::destroySelf<IMatrix>(IMatrix&);
+template void Element::destroySelf<CellularMatrix>(CellularMatrix&);
\ No newline at end of file
@@ -7,11 +7,15 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <cstdint>
 #include <unordered_map>
 #include "src/elements/ElementFactory.hpp"
+#include "src/elements/ElementProperties.hpp"
 #include "src/elements/utilities/rng/ElementRNG.hpp"
+#include "src/elements/utilities/pool/ElementPool.hpp"
 #include "src/core/IMatrix.hpp"
 
+class CellularMatrix;
 
 /**
  * @brief Base class for all elements in the simulation.
@@ -21,12 +25,24 @@ public:
 	// ========= Construction & Destruction =========
 	Element(ElementType type, int x, int y);
 	virtual ~Element() = default;
+
+	// Cells come from ElementPool slabs rather than one heap allocation each
+	static void* operator new(size_t size) { return ElementPool::allocate(size); }
+	static void operator delete(void* pointer, size_t size) { ElementPool::deallocate(pointer, size); }
 	
 	// ========= Core Update Interface =========
+	// Both overloads run the same kernel. The simulation calls the
+	// CellularMatrix one, whose matrix accesses are direct and inlinable;
+	// the IMatrix one serves tests and mocks.
 	virtual void update(IMatrix& matrix) = 0;
+	virtual void update(CellularMatrix& matrix) = 0;
+
+	// Types whose update never does anything; the matrix skips them entirely
+	static constexpr bool IS_INERT = false;
 	
 	// ========= Element Metadata =========
-	ElementType getType() const;
+	ElementType getType() const { return m_Type; }
+	const ElementProperties& getProperties() const { return ELEMENT_PROPERTIES[m_Type]; }
 	std::string getTypeString() const;
 	SDL_Color getColor() const;
 	void setColor(const SDL_Color& newColor);
@@ -39,6 +55,18 @@ public:
 	int getPosX() const;
 	int getPosY() const;
 	void setPosition(int x, int y);
+
+	// ========= Reactions =========
+	// Tick a neighbor reaction is due on, drawn by the matrix from the per-tick
+	// chance of its current neighbors, and whether a wake-up is scheduled for
+	// it. The roll is memoryless, so moving or a change of neighbors simply
+	// clears it for a new draw.
+	static constexpr uint64_t NO_TICK = UINT64_MAX;
+	uint64_t getReactionTick() const { return m_ReactionTick; }
+	float getReactionChance() const { return m_ReactionChance; }
+	void setReaction(uint64_t tick, float chance) { m_ReactionTick = tick; m_ReactionChance = chance; m_ReactionWakeScheduled = false; }
+	bool isReactionWakeScheduled() const { return m_ReactionWakeScheduled; }
+	void setReactionWakeScheduled() { m_ReactionWakeScheduled = true; }
 	
 	// ========= Template Functions =========
 	template<typename T>
@@ -55,16 +83,21 @@ protected:
 	bool checkIfUpdated();
 
 	// ========= Element Management =========
-	void destroyElement(IMatrix& matrix, int x, int y);
-	void destroySelf(IMatrix& matrix);
+	template<typename TMatrix>
+	void destroyElement(TMatrix& matrix, int x, int y);
+	template<typename TMatrix>
+	void destroySelf(TMatrix& matrix);
 
 	// ========= Member Variables =========
 	ElementType m_Type = EMPTY;
 	SDL_Color m_Color = {255, 255, 255, 255};
 	SDL_Color m_OriginalColor = {255, 255, 255, 255};
 	bool m_Step = false;
+	bool m_ReactionWakeScheduled = false;
 	int m_PosX = 0;
 	int m_PosY = 0;
+	float m_ReactionChance = 0.0f;
+	uint64_t m_ReactionTick = NO_TICK;
 };
 
 #endif // ELEMENT_HPP
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "src/elements/types/Smoke.hpp"
 #include "src/elements/types/Steam.hpp"
 #include "src/elements/types/Fire.hpp"
+#include "src/elements/types/Wall.hpp"
 
 // ===============================
 // Factory Function Implementation
@@ -29,27 +30,29 @@
  * Otherwise, return a default Empty element.
  */
 Element* ElementFactory::createElementFromType(ElementType type, int x, int y) {
-	auto it = elementRegistry.find(type);
-	if (it != elementRegistry.end() && it->second.factory) {
-		return it->second.factory(x, y);
+	if (FactoryFunction factory = elementRegistry[type].factory) {
+		return factory(x, y);
 	}
 	return new Empty(x, y);
 }
 
 // Static member definitions
-std::map<ElementType, ElementFactory::ElementInfo> ElementFactory::elementRegistry;
-std::map<ElementType, SDL_Surface*> ElementFactory::textureMap;
+std::array<ElementFactory::ElementInfo, ELEMENT_TYPE_COUNT> ElementFactory::elementRegistry;
+std::array<ElementFactory::MaterialTexture, ELEMENT_TYPE_COUNT> ElementFactory::textureMap;
 std::vector<ElementType> ElementFactory::registeredElements;
+UpdateKernel ElementFactory::updateKernels[ELEMENT_TYPE_COUNT] = {};
 std::mt19937 ElementFactory::rng{std::random_device{}()};
 
 /**
  * Template method to register a new element in the registry.
  * Stores metadata, a factory function, and optional texture path.
+ * Elements that are not selectable are left out of getRegisteredElements().
  */
 template<typename T>
 void ElementFactory::registerElement(ElementType type, const std::string& name,
 									 const SDL_Color& color, int colorOffset,
-									 const std::string& texturePath) {
+									 const std::string& texturePath,
+									 bool selectable) {
 	elementRegistry[type] = ElementInfo(
 		name,
 		color,
@@ -57,7 +60,18 @@ void ElementFactory::registerElement(ElementType type, const std::string& name,
 		[](int x, int y) -> Element* { return new T(x, y); },
 		texturePath
 	);
-	registeredElements.push_back(type);
+	if (selectable) {
+		registeredElements.push_back(type);
+	}
+
+	// Qualified call: T's own update, without going through the vtable
+	if constexpr (T::IS_INERT) {
+		updateKernels[type] = nullptr;
+	} else {
+		updateKernels[type] = [](Element& element, CellularMatrix& matrix) {
+			static_cast<T&>(element).T::update(matrix);
+		};
+	}
 }
 
 /**
@@ -65,7 +79,7 @@ void ElementFactory::registerElement(ElementType type, const std::string& name,
  * Also loads textures for any elements that specify a texture path.
  */
 void ElementFactory::initialize() {
-	elementRegistry.clear();
+	elementRegistry.fill(ElementInfo());
 	registeredElements.clear();
 
 	// Register all element types here (type, name, base color, color offset, [optional] texture path)
@@ -82,20 +96,44 @@ void ElementFactory::initialize() {
 	registerElement<Smoke>(SMOKE, "Smoke", {33, 33, 33, 125}, 1);
 	registerElement<Steam>(STEAM, "Steam", {100, 100, 100, 125}, 1);
 	registerElement<Fire>(FIRE, "Fire", {255, 165, 0, 200}, 10);
-
-	// Load textures for elements that have a valid texture path
-	for (const auto& [type, info] : elementRegistry) {
-		if (!info.texturePath.empty()) {
-			SDL_Surface* texture = IMG_Load(info.texturePath.c_str());
-			if (texture) {
-				textureMap[type] = texture;
-			} else {
+	registerElement<Wall>(WALL, "Wall", {0, 0, 0, 0}, 0, "", false);
+
+	// Load and bake textures for elements that have a valid texture path
+	for (int type = 0; type < ELEMENT_TYPE_COUNT; ++type) {
+		const ElementInfo& info = elementRegistry[type];
+		if (!info.texturePath.empty() && textureMap[type].pixels.empty()) {
+			SDL_Surface* surface = IMG_Load(info.texturePath.c_str());
+			if (!surface || !bakeTexture(surface, textureMap[type])) {
 				std::cerr << "Failed to load texture for " << info.name << ": " << info.texturePath << '\n';
 			}
+			if (surface) {
+				SDL_FreeSurface(surface);
+			}
 		}
 	}
 }
 
+/**
+ * Converts a loaded surface once into a packed RGBA8888 color table, so later
+ * lookups are a plain array read instead of an SDL pixel-format conversion.
+ */
+bool ElementFactory::bakeTexture(SDL_Surface* surface, MaterialTexture& texture) {
+	SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA8888, 0);
+	if (!converted) return false;
+
+	SDL_LockSurface(converted);
+	texture.width = converted->w;
+	texture.height = converted->h;
+	texture.pixels.resize(static_cast<size_t>(texture.width) * texture.height);
+	for (int y = 0; y < texture.height; ++y) {
+		const Uint8* row = static_cast<const Uint8*>(converted->pixels) + y * converted->pitch;
+		memcpy(&texture.pixels[static_cast<size_t>(y) * texture.width], row, texture.width * sizeof(Uint32));
+	}
+	SDL_UnlockSurface(converted);
+	SDL_FreeSurface(converted);
+	return texture.width > 0 && texture.height > 0;
+}
+
 /**
  * Returns a list of all registered ElementTypes.
  */
@@ -106,9 +144,8 @@ std::vector<ElementType> ElementFactory::getRegisteredElements() {
 /**
  * Returns the name string associated with an ElementType.
  */
-std::string ElementFactory::getElementName(ElementType type) {
-	auto it = elementRegistry.find(type);
-	return (it != elementRegistry.end()) ? it->second.name : "Unknown";
+const std::string& ElementFactory::getElementName(ElementType type) {
+	return elementRegistry[type].name;
 }
 
 /**
@@ -116,29 +153,28 @@ std::string ElementFactory::getElementName(ElementType type) {
  * (if available) or a base color with offset variation.
  */
 SDL_Color ElementFactory::getColorByElementType(ElementType type, int x, int y) {
-	auto it = textureMap.find(type);
-	if (it == textureMap.end() || !it->second) {
-		return getOffsetColor(type);
-	} else {
-		return getTextureColor(type, it->second, x, y);
+	const MaterialTexture& texture = textureMap[type];
+	if (!texture.pixels.empty()) {
+		return getTextureColor(texture, x, y);
 	}
+	return getOffsetColor(type);
 }
 
 /**
- * Samples a pixel color from a texture at coordinates (x, y), wrapping
+ * Samples a pixel color from a baked texture at coordinates (x, y), wrapping
  * coordinates around the texture's width and height.
  */
-SDL_Color ElementFactory::getTextureColor(ElementType /*type*/, SDL_Surface* surface, int x, int y) {
-	x = ((x % surface->w) + surface->w) % surface->w;  // wrap around texture width
-	y = ((y % surface->h) + surface->h) % surface->h;  // wrap around texture height
-
-	Uint8* pixel_ptr = static_cast<Uint8*>(surface->pixels) + y * surface->pitch + x * surface->format->BytesPerPixel;
-	Uint32 pixel = 0;
-	memcpy(&pixel, pixel_ptr, surface->format->BytesPerPixel);
-
-	SDL_Color color;
-	SDL_GetRGBA(pixel, surface->format, &color.r, &color.g, &color.b, &color.a);
-	return color;
+SDL_Color ElementFactory::getTextureColor(const MaterialTexture& texture, int x, int y) {
+	x = ((x % texture.width) + texture.width) % texture.width;     // wrap around texture width
+	y = ((y % texture.height) + texture.height) % texture.height;  // wrap around texture height
+
+	Uint32 pixel = texture.pixels[static_cast<size_t>(y) * texture.width + x];
+	return {
+		static_cast<Uint8>(pixel >> 24),
+		static_cast<Uint8>(pixel >> 16),
+		static_cast<Uint8>(pixel >> 8),
+		static_cast<Uint8>(pixel)
+	};
 }
 
 /**
@@ -146,13 +182,10 @@ SDL_Color ElementFactory::getTextureColor(ElementType /*type*/, SDL_Surface* sur
  * with a slight random offset applied for visual variation.
  */
 SDL_Color ElementFactory::getOffsetColor(ElementType type) {
-	auto it = elementRegistry.find(type);
-	if (it == elementRegistry.end()) {
-		return {0, 0, 0, 255};  // fallback color
-	}
-
-	SDL_Color color = it->second.color;
-	int offset = getRandomOffset(it->second.colorOffset);
+	// Unregistered types keep the default info: opaque black, no offset
+	const ElementInfo& info = elementRegistry[type];
+	SDL_Color color = info.color;
+	int offset = getRandomOffset(info.colorOffset);
 	color.r = std::clamp(color.r + offset, 0, 255);
 	color.g = std::clamp(color.g + offset, 0, 255);
 	color.b = std::clamp(color.b + offset, 0, 255);
@@ -163,6 +196,7 @@ SDL_Color ElementFactory::getOffsetColor(ElementType type) {
  * Returns a random integer between [-offset, offset].
  */
 int ElementFactory::getRandomOffset(int offset) {
+	if (offset == 0) return 0; // Empty and Wall are created in bulk
 	std::uniform_int_distribution<int> dist(-offset, offset);
 	return dist(rng);
 }
\ No newline at end of file
@@ -2,11 +2,11 @@
 #ifndef ELEMENT_FACTORY_HPP
 #define ELEMENT_FACTORY_HPP
 
-#include <map>
+#include <array>
+#include <string>
 #include <vector>
 #include <random>
 #include <algorithm>
-#include <functional>
 #include <SDL2/SDL.h>
 
 //-------------------------------------------
@@ -26,39 +26,52 @@ enum ElementType {
 	SMOKE,
 	STEAM,
 	FIRE,
+	WALL,  // Ghost border around the world, not selectable
+	ELEMENT_TYPE_COUNT
 };
 
 // Forward declare Element class since we only need the pointer type
 class Element;
+class CellularMatrix;
+
+// Per-type update kernel; CellularMatrix dispatches through these instead of the virtual Element::update
+using UpdateKernel = void (*)(Element& element, CellularMatrix& matrix);
 
 class ElementFactory {
 	public:
 		// All methods and members are static
 		static SDL_Color getColorByElementType(ElementType type, int x, int y);
+		static SDL_Color getBaseColor(ElementType type) { return elementRegistry[type].color; } // Registered color, no offset or texture
 		static void initialize();
 		
 		// New registration system
 		static std::vector<ElementType> getRegisteredElements();
-		static std::string getElementName(ElementType type);
+		static const std::string& getElementName(ElementType type); // Non-allocating, "Unknown" if unregistered
 		static Element* createElementFromType(ElementType type, int x, int y);
+
+		// Kernel of a type, nullptr for inert types (nothing to update)
+		static UpdateKernel getUpdateKernel(ElementType type) { return updateKernels[type]; }
 		
 	private:
+		using FactoryFunction = Element* (*)(int x, int y);
+
 		struct ElementInfo {
 			std::string name;
 			SDL_Color color;
 			int colorOffset;
-			std::function<Element*(int, int)> factory;
+			FactoryFunction factory;
 			std::string texturePath;
 			
 			ElementInfo()
-				: name(""),
-				color{0, 0, 0, 0},
+				: name("Unknown"),
+				color{0, 0, 0, 255},
 				colorOffset(0),
+				factory(nullptr),
 				texturePath("")
 			{}
 
 			ElementInfo(const std::string& n, const SDL_Color& c, int offset,
-						std::function<Element*(int, int)> f, const std::string& texture = "")
+						FactoryFunction f, const std::string& texture = "")
 				: name(n),
 				color(c),
 				colorOffset(offset),
@@ -67,12 +80,22 @@ class ElementFactory {
 			{}
 		};
 		
-		static SDL_Color getTextureColor(ElementType type, SDL_Surface* surface, int x, int y);
+		// Material texture baked at startup into packed RGBA8888 (the pixel format of the world texture)
+		struct MaterialTexture {
+			int width = 0;
+			int height = 0;
+			std::vector<Uint32> pixels;
+		};
+
+		static bool bakeTexture(SDL_Surface* surface, MaterialTexture& texture);
+		static SDL_Color getTextureColor(const MaterialTexture& texture, int x, int y);
 		static SDL_Color getOffsetColor(ElementType type);
 		
-		static std::map<ElementType, ElementInfo> elementRegistry;
-		static std::map<ElementType, SDL_Surface*> textureMap;
+		// Flat tables indexed by ElementType
+		static std::array<ElementInfo, ELEMENT_TYPE_COUNT> elementRegistry;
+		static std::array<MaterialTexture, ELEMENT_TYPE_COUNT> textureMap;
 		static std::vector<ElementType> registeredElements;
+		static UpdateKernel updateKernels[ELEMENT_TYPE_COUNT];
 		static std::mt19937 rng;
 		static int getRandomOffset(int offset);
 		
@@ -80,7 +103,8 @@ class ElementFactory {
 		template<typename T>
 		static void registerElement(ElementType type, const std::string& name, 
 									const SDL_Color& color, int colorOffset,
-									const std::string& texturePath = "");
+									const std::string& texturePath = "",
+									bool selectable = true);
 };
 
 #endif // ELEMENT_FACTORY_HPP
\ No newline at end of file
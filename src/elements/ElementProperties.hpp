@@ -0,0 +1,118 @@
+// src/elements/ElementProperties.hpp
+#ifndef ELEMENT_PROPERTIES_HPP
+#define ELEMENT_PROPERTIES_HPP
+
+#include <array>
+#include "src/elements/ElementFactory.hpp"
+
+/**
+ * @brief Material constants shared by every element of one type.
+ *
+ * Elements only store their dynamic state; everything that is fixed per
+ * ElementType lives in ELEMENT_PROPERTIES and is read through
+ * Element::getProperties(). Fields that do not apply to a type keep their
+ * defaults and are never read for it.
+ */
+struct ElementProperties {
+	// Movable elements
+	float density = 0.5f;              ///< Heavier elements sink below lighter ones
+
+	// Powders
+	float friction = 0.1f;             ///< Chance per update to stop sliding when grounded
+	float impactAbsorption = 0.5f;     ///< Impact absorption factor for collisions
+	float inertialResistance = 0.0f;   ///< Chance to ignore a moving neighbor
+
+	// Liquids
+	int dispersionRate = 32;           ///< Maximum horizontal spread per update
+
+	// Rising elements
+	float chanceOfHorizontal = 0.5f;   ///< Chance to drift sideways instead of straight up
+
+	// Gases
+	int lifetime = 100;                ///< Updates before the gas may dissipate
+	float chanceOfDeathAfterLifetime = 0.01f; ///< Chance per update to dissipate after that
+
+	// Heat (see TemperatureField; transitions are in PhaseTransitions.hpp)
+	float conductivity = 0.05f;        ///< Share of a temperature difference crossed per tick, at most 0.24
+	float sourceTemperature = 0.0f;    ///< Holds its cell at this temperature while it updates or burns (0: none)
+
+	// Combustion (see CombustionSystem)
+	float flammability = 0.0f;         ///< Chance per tick to catch fire from each burning neighbor
+	int burnTime = 0;                  ///< Ticks a cell of this fuel burns once lit
+	ElementType burnResidue = EMPTY;   ///< Left behind, with residueChance, once burnt out
+	float residueChance = 0.0f;
+	float smokeChance = 0.0f;          ///< Per tick, for a burning cell with open air above
+};
+
+/**
+ * @brief Builds the per-type table. Add a type's constants here when registering it
+ * in ElementFactory::initialize.
+ */
+constexpr std::array<ElementProperties, ELEMENT_TYPE_COUNT> makeElementProperties() {
+	std::array<ElementProperties, ELEMENT_TYPE_COUNT> table {};
+
+	// Powders
+	table[SAND].density = 0.8f;
+	table[SAND].friction = 0.035f;
+	table[SAND].inertialResistance = 0.0f;
+
+	table[DIRT].density = 0.85f;
+	table[DIRT].friction = 0.2f;
+	table[DIRT].inertialResistance = 0.5f;
+
+	table[COAL].density = 0.9f;
+	table[COAL].friction = 0.2f;
+	table[COAL].inertialResistance = 0.3f;
+
+	table[SALT].density = 0.2f;
+
+	table[ASH].density = 0.1f;
+
+	// Liquids
+	table[WATER].density = 0.5f;
+	table[OIL].density = 0.4f;
+
+	// Gases
+	table[SMOKE].density = 0.05f;
+	table[STEAM].density = 0.02f;
+
+	// Heat. Walls insulate, air (EMPTY) and gases conduct poorly.
+	table[WALL].conductivity = 0.0f;
+	table[STONE].conductivity = 0.15f;
+	table[SAND].conductivity = 0.08f;
+	table[DIRT].conductivity = 0.06f;
+	table[COAL].conductivity = 0.1f;
+	table[SALT].conductivity = 0.08f;
+	table[ASH].conductivity = 0.03f;
+	table[WOOD].conductivity = 0.04f;
+	table[WATER].conductivity = 0.2f;
+	table[OIL].conductivity = 0.1f;
+	table[FIRE].conductivity = 0.2f;
+	table[FIRE].sourceTemperature = 800.0f;
+
+	// Combustion. A bare flame burns briefly; fuels burn longer and may leave ash.
+	table[FIRE].burnTime = 15;
+	table[FIRE].smokeChance = 0.5f;
+
+	table[WOOD].flammability = 0.01f;
+	table[WOOD].burnTime = 100;
+	table[WOOD].burnResidue = ASH;
+	table[WOOD].residueChance = 0.1f;
+	table[WOOD].smokeChance = 1.0f;
+
+	table[OIL].flammability = 0.8f;
+	table[OIL].burnTime = 15;
+	table[OIL].smokeChance = 0.7f;
+
+	table[COAL].flammability = 0.002f;
+	table[COAL].burnTime = 400;
+	table[COAL].burnResidue = ASH;
+	table[COAL].residueChance = 0.5f;
+	table[COAL].smokeChance = 0.3f;
+
+	return table;
+}
+
+inline constexpr std::array<ElementProperties, ELEMENT_TYPE_COUNT> ELEMENT_PROPERTIES = makeElementProperties();
+
+#endif // ELEMENT_PROPERTIES_HPP
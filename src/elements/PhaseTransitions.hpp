@@ -0,0 +1,73 @@
+// src/elements/PhaseTransitions.hpp
+#ifndef PHASE_TRANSITIONS_HPP
+#define PHASE_TRANSITIONS_HPP
+
+#include <array>
+#include <limits>
+#include "src/elements/ElementFactory.hpp"
+
+/**
+ * @brief An element turning into another when its cell's temperature crosses
+ * a threshold.
+ *
+ * Transitions are plain data, applied by TemperatureField to every warm cell
+ * each tick; elements do not check their own temperature.
+ */
+struct PhaseTransition {
+	enum Direction {
+		HEATING,  ///< At or above the threshold
+		COOLING   ///< Dropping below the threshold from at or above it
+	};
+
+	ElementType from;
+	float threshold;
+	Direction direction;
+	ElementType to;
+};
+
+/**
+ * @brief All transitions, at most one per type and direction. A type's heating
+ * threshold must lie above its cooling one. Transitions to FIRE ignite the cell
+ * (see CombustionSystem).
+ */
+inline constexpr PhaseTransition PHASE_TRANSITIONS[] = {
+	{WATER, 100.0f, PhaseTransition::HEATING, STEAM}, // boils
+	{STEAM,  90.0f, PhaseTransition::COOLING, WATER}, // condenses, a little under boiling
+	{WOOD,  300.0f, PhaseTransition::HEATING, FIRE},  // ignites
+	{OIL,   200.0f, PhaseTransition::HEATING, FIRE}
+};
+
+/**
+ * @brief PHASE_TRANSITIONS by type, for branch-free threshold compares. Types
+ * without a transition in a direction get a threshold no temperature crosses.
+ */
+struct PhaseTransitionLookup {
+	std::array<float, ELEMENT_TYPE_COUNT> heatingThreshold {};
+	std::array<ElementType, ELEMENT_TYPE_COUNT> heatingTarget {};
+	std::array<float, ELEMENT_TYPE_COUNT> coolingThreshold {};
+	std::array<ElementType, ELEMENT_TYPE_COUNT> coolingTarget {};
+};
+
+constexpr PhaseTransitionLookup makePhaseTransitionLookup() {
+	PhaseTransitionLookup lookup {};
+	for (int type = 0; type < ELEMENT_TYPE_COUNT; ++type) {
+		lookup.heatingThreshold[type] = std::numeric_limits<float>::infinity();
+		lookup.heatingTarget[type] = static_cast<ElementType>(type);
+		lookup.coolingThreshold[type] = -std::numeric_limits<float>::infinity();
+		lookup.coolingTarget[type] = static_cast<ElementType>(type);
+	}
+	for (const PhaseTransition& transition : PHASE_TRANSITIONS) {
+		if (transition.direction == PhaseTransition::HEATING) {
+			lookup.heatingThreshold[transition.from] = transition.threshold;
+			lookup.heatingTarget[transition.from] = transition.to;
+		} else {
+			lookup.coolingThreshold[transition.from] = transition.threshold;
+			lookup.coolingTarget[transition.from] = transition.to;
+		}
+	}
+	return lookup;
+}
+
+inline constexpr PhaseTransitionLookup PHASE_TRANSITION_LOOKUP = makePhaseTransitionLookup();
+
+#endif // PHASE_TRANSITIONS_HPP
@@ -0,0 +1,59 @@
+// src/elements/Reactions.hpp
+#ifndef REACTIONS_HPP
+#define REACTIONS_HPP
+
+#include <array>
+#include <cstdint>
+#include "src/elements/ElementFactory.hpp"
+
+/**
+ * @brief What happens when an element updates next to an element of another type.
+ *
+ * Reactions are plain data, evaluated by CellularMatrix against the eight
+ * neighbors of every updating cell whose type has any; elements carry no
+ * reaction code of their own.
+ */
+struct Reaction {
+	ElementType self;
+	ElementType neighbor;
+	float chance;                 ///< Per update of self, for each such neighbor
+	ElementType selfProduct;      ///< What self turns into (self: unchanged)
+	ElementType neighborProduct;  ///< What the neighbor turns into (neighbor: unchanged)
+	ElementType byproduct;        ///< Placed in the cell above self if that is empty (EMPTY: none)
+};
+
+/**
+ * @brief All reactions, at most one per (self, neighbor) pair.
+ */
+inline constexpr Reaction REACTIONS[] = {
+	{SALT, WATER, 0.005f, EMPTY, WATER, EMPTY} // dissolves
+};
+
+/**
+ * @brief REACTIONS by (self, neighbor) type, with a per-type mask of the
+ * neighbor types it reacts with. Types with an empty mask skip the
+ * neighborhood pass entirely.
+ */
+struct ReactionLookup {
+	static_assert(ELEMENT_TYPE_COUNT <= 32, "Neighbor masks hold one bit per type");
+
+	std::array<uint32_t, ELEMENT_TYPE_COUNT> neighborMask {};
+	std::array<std::array<int8_t, ELEMENT_TYPE_COUNT>, ELEMENT_TYPE_COUNT> index {}; ///< Into REACTIONS
+
+	constexpr bool hasReactions(ElementType type) const { return neighborMask[type] != 0; }
+	constexpr bool reactsWith(ElementType type, ElementType neighbor) const { return (neighborMask[type] >> neighbor) & 1u; }
+};
+
+constexpr ReactionLookup makeReactionLookup() {
+	ReactionLookup lookup {};
+	for (size_t i = 0; i < std::size(REACTIONS); ++i) {
+		const Reaction& reaction = REACTIONS[i];
+		lookup.neighborMask[reaction.self] |= 1u << reaction.neighbor;
+		lookup.index[reaction.self][reaction.neighbor] = static_cast<int8_t>(i);
+	}
+	return lookup;
+}
+
+inline constexpr ReactionLookup REACTION_LOOKUP = makeReactionLookup();
+
+#endif // REACTIONS_HPP
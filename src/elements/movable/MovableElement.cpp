@@ -1,5 +1,6 @@
 // src/elements/movable/MovableElement.cpp
 #include "src/elements/movable/MovableElement.hpp"
+#include "src/core/CellularMatrix.hpp"
 
 void MovableElement::setVelocityX(float velocityX) {
 	m_VelocityX = std::clamp(velocityX, -32.0f, 32.0f);
@@ -23,9 +24,9 @@ float MovableElement::getVelocityY() const { return m_VelocityY; }
 bool MovableElement::getIsMoving() const { return m_IsMoving; }
 void MovableElement::setIsMoving(bool isMoving) { m_IsMoving = isMoving; }
 
-float MovableElement::getDensity() const { return m_Density; }
 
-void MovableElement::swapWithElement(IMatrix& matrix, int x, int y) {
+template<typename TMatrix>
+void MovableElement::swapWithElement(TMatrix& matrix, int x, int y) {
 	if (x == m_PosX && y == m_PosY) return;
 	Element* target = matrix.getElement(x, y);
 
@@ -42,7 +43,8 @@ void MovableElement::swapWithElement(IMatrix& matrix, int x, int y) {
 	matrix.swapElements(m_PosX, m_PosY, x, y);
 }
 
-void MovableElement::swapElements(IMatrix& matrix, int x1, int y1, int x2, int y2) {
+template<typename TMatrix>
+void MovableElement::swapElements(TMatrix& matrix, int x1, int y1, int x2, int y2) {
 	if (x1 == x2 && y1 == y2) return;
 	Element* elem1 = matrix.getElement(x1, y1);
 	Element* elem2 = matrix.getElement(x2, y2);
@@ -58,21 +60,25 @@ void MovableElement::swapElements(IMatrix& matrix, int x1, int y1, int x2, int y
 	matrix.swapElements(x1, y1, x2, y2);
 }
 
-void MovableElement::affectAdjacentNeighbors(IMatrix& matrix) {
-	if (matrix.isInBounds(m_PosX - 1, m_PosY)) {
-		if (Element* left = matrix.getElement(m_PosX - 1, m_PosY)) {
-			if (auto movable = left->as<MovableElement>()) {
-				movable->recieveNeighborEffect();
-			}
-			matrix.activateChunk(m_PosX - 1, m_PosY);
-		}
+template<typename TMatrix>
+void MovableElement::affectAdjacentNeighbors(TMatrix& matrix) {
+	Element* left = matrix.getElement(m_PosX - 1, m_PosY);
+	if (auto movable = left->as<MovableElement>()) {
+		movable->recieveNeighborEffect();
 	}
-	if (matrix.isInBounds(m_PosX + 1, m_PosY)) {
-		if (Element* right = matrix.getElement(m_PosX + 1, m_PosY)) {
-			if (auto movable = right->as<MovableElement>()) {
-				movable->recieveNeighborEffect();
-			}
-			matrix.activateChunk(m_PosX + 1, m_PosY);
-		}
+	matrix.activateChunk(m_PosX - 1, m_PosY);
+
+	Element* right = matrix.getElement(m_PosX + 1, m_PosY);
+	if (auto movable = right->as<MovableElement>()) {
+		movable->recieveNeighborEffect();
 	}
-}
\ No newline at end of file
+	matrix.activateChunk(m_PosX + 1, m_PosY);
+}
+
+// Kernels are instantiated for the generic interface and for the concrete matrix
+template void MovableElement::swapWithElement<IMatrix>(IMatrix&, int, int);
+template void MovableElement::swapWithElement<CellularMatrix>(CellularMatrix&, int, int);
+template void MovableElement::swapElements<IMatrix>(IMatrix&, int, int, int, int);
+template void MovableElement::swapElements<CellularMatrix>(CellularMatrix&, int, int, int, int);
+template void MovableElement::affectAdjacentNeighbors<IMatrix>(IMatrix&);
+template void MovableElement::affectAdjacentNeighbors<CellularMatrix>(CellularMatrix&);
@@ -53,7 +53,7 @@ public:
 	 */
 	float getVelocityY() const;
 
-	float getDensity() const;
+	float getDensity() const { return getProperties().density; }
 
 	/**
 	 * @return Whether the element is currently marked as moving.
@@ -84,7 +84,8 @@ protected:
 	 * @param x Target x-coordinate.
 	 * @param y Target y-coordinate.
 	 */
-	void swapWithElement(IMatrix& matrix, int x, int y);
+	template<typename TMatrix>
+	void swapWithElement(TMatrix& matrix, int x, int y);
 
 	/**
 	 * @brief Swap two elements at arbitrary coordinates.
@@ -97,26 +98,16 @@ protected:
 	 * @param x2 Second element's x-coordinate.
 	 * @param y2 Second element's y-coordinate.
 	 */
-	void swapElements(IMatrix& matrix, int x1, int y1, int x2, int y2);
-
-	/**
-	 * @brief Determine whether this element can swap with another at the given coordinates.
-	 * 
-	 * This is a pure virtual function that must be implemented by derived classes.
-	 * 
-	 * @param matrix The simulation matrix.
-	 * @param x Target x-coordinate.
-	 * @param y Target y-coordinate.
-	 * @return true if a swap is permitted; false otherwise.
-	 */
-	virtual bool canSwapWithElement(IMatrix& matrix, int x, int y) const = 0;
+	template<typename TMatrix>
+	void swapElements(TMatrix& matrix, int x1, int y1, int x2, int y2);
 
 	/**
 	 * @brief Notifies adjacent elements that this one has moved.
 	 * 
 	 * Used to trigger responses in neighboring elements, such as causing them to fall.
 	 */
-	void affectAdjacentNeighbors(IMatrix& matrix);
+	template<typename TMatrix>
+	void affectAdjacentNeighbors(TMatrix& matrix);
 
 	/**
 	 * @brief Respond to the movement of a neighboring element.
@@ -125,10 +116,6 @@ protected:
 	 */
 	virtual void recieveNeighborEffect() = 0;
 
-	virtual void handleBuoyancy(IMatrix& matrix) = 0;
-
-	float m_Density = 0.5f;
-
 	// ========== Movement State Variables ==========
 
 	float m_VelocityX = 0;       ///< Horizontal velocity component
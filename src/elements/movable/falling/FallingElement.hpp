@@ -2,61 +2,183 @@
 #define FALLING_ELEMENT_HPP
 
 #include "src/elements/movable/MovableElement.hpp"
+#include <algorithm>
+#include <type_traits>
 
 /**
  * @brief Abstract base class for elements that fall due to gravity.
  *
  * Inherits from MovableElement and provides basic gravity and falling logic.
- * Derived classes must implement the `handleGrounded` method to define behavior
- * when the element is no longer falling.
+ * Uses CRTP: TDerived must provide `canSwapWithElement` and `handleGrounded`
+ * as member templates over the matrix type, which handleFalling calls without
+ * virtual dispatch. TDerived befriends FallingElement<TDerived> to expose them.
  */
+template<typename TDerived>
 class FallingElement : public MovableElement {
 protected:
 	// ========== Construction ==========
 	FallingElement(ElementType type, int x, int y) : MovableElement(type, x, y) {}
 
-	/**
-	 * @brief Determine whether this element can swap with another at the given coordinates.
-	 *
-	 * This function is used to decide if the element can move to the specified (x, y) location.
-	 * Must be overridden in derived classes to define specific rules.
-	 *
-	 * @param matrix The simulation matrix.
-	 * @param x The x-coordinate to test.
-	 * @param y The y-coordinate to test.
-	 * @return true if a swap is allowed; false otherwise.
-	 */
-	bool canSwapWithElement(IMatrix& matrix, int x, int y) const override = 0;
-
-	/**
-	 * @brief React to the movement of a neighboring element.
-	 *
-	 * Default implementation does nothing. Can be overridden in subclasses.
-	 */
-	void recieveNeighborEffect() override = 0;
-
 	/**
 	 * @brief Handles the logic for gravity-based falling movement.
 	 *
 	 * Applies gravity, velocity, and collision detection, and updates position accordingly.
+	 * When the element cannot fall, TDerived::handleGrounded is called.
 	 *
 	 * @param matrix The simulation matrix.
 	 */
-	void handleFalling(IMatrix& matrix);
+	template<typename TMatrix>
+	void handleFalling(TMatrix& matrix);
 
 	/**
-	 * @brief Called when the element is considered grounded (not falling).
+	 * @brief Moves this element and the run of same-type elements above it down
+	 * through empty space as one column shift.
 	 *
-	 * Subclasses must define how grounded elements behave.
+	 * Each element of the run gets the velocity, accumulator and flags the
+	 * per-element path would have given it (including the velocity handed up
+	 * from the element below), so a free-falling blob costs one shift per
+	 * column instead of one probe loop and swap per element. The run ends at
+	 * the first element that would not keep up with the one below it.
 	 *
 	 * @param matrix The simulation matrix.
+	 * @return false, with nothing changed, when the per-element path must run
 	 */
-	virtual void handleGrounded(IMatrix& matrix) = 0;
-
-	void handleBuoyancy(IMatrix& matrix) override = 0;
+	template<typename TMatrix>
+	bool fallAsColumn(TMatrix& matrix);
 
 	/// Constant gravitational acceleration per frame
 	const float GRAVITY = 0.2;
+
+private:
+	TDerived& derived() { return static_cast<TDerived&>(*this); }
 };
 
+template<typename TDerived>
+template<typename TMatrix>
+void FallingElement<TDerived>::handleFalling(TMatrix& matrix) {
+	// Free fall through open air is handled a column at a time
+	if constexpr (std::is_same_v<TMatrix, CellularMatrix>) {
+		if (fallAsColumn(matrix)) return;
+	}
+
+	int x = m_PosX;
+	int y = m_PosY;
+	// Check if the space directly below can be swapped into (i.e., is empty or can be moved into)
+	if (derived().canSwapWithElement(matrix, x, y + 1)) {
+		m_IsMoving = true; // Mark this element as currently moving
+
+		// Apply gravitational force to vertical velocity
+		addVelocityY(GRAVITY); // Increase vertical velocity by gravity constant
+
+		// Accumulate vertical motion for sub-pixel movement
+		m_AccumulatedY += getVelocityY();
+
+		// Calculate how many integer rows we are ready to fall (truncate to int)
+		int deltaY = static_cast<int>(m_AccumulatedY);
+
+		if (deltaY != 0) {
+			int lastValidY = y; // Track the furthest valid Y position we can move to
+
+			// Try to fall as far as allowed by collision rules, up to deltaY rows
+			for (int i = 1; i <= std::abs(deltaY); ++i) {
+				int checkY = y + (deltaY > 0 ? i : -i); // Check each row in the direction of movement
+
+				// If we can swap with the element at (x, checkY), update lastValidY
+				if (derived().canSwapWithElement(matrix, x, checkY)) {
+					lastValidY = checkY;
+				} else {
+					break; // Stop if we hit an obstacle
+				}
+			}
+
+			// Only perform the swap if we actually moved to a new row
+			if (lastValidY != y) {
+				// If there is a movable element above, transfer our vertical velocity to it
+				Element* above = matrix.getElement(x, y - 1);
+				if (auto movable = above->as<MovableElement>()) {
+					movable->setVelocityY(getVelocityY());
+				}
+				// Swap this element with the one at the new position
+				swapWithElement(matrix, x, lastValidY);
+				// Optionally affect adjacent neighbors (e.g., for sand spreading)
+				affectAdjacentNeighbors(matrix);
+
+				// Remove the moved portion from the accumulator (keep the fractional part)
+				m_AccumulatedY -= (lastValidY - y);
+			}
+		}
+	} else {
+		// If we can't fall, reset vertical velocity and accumulator
+		setVelocityY(0.0f);
+		m_AccumulatedY = 0.0f;
+		// Call subclass-defined behavior for grounded state (e.g., sand settling)
+		derived().handleGrounded(matrix);
+	}
+}
+
+template<typename TDerived>
+template<typename TMatrix>
+bool FallingElement<TDerived>::fallAsColumn(TMatrix& matrix) {
+	int x = m_PosX;
+	int bottomY = m_PosY;
+	if (!matrix.isEmpty(x, bottomY + 1)) return false;
+
+	// Our own step, as handleFalling would take it
+	float velocity = std::clamp(getVelocityY() + GRAVITY, -32.0f, 32.0f);
+	float accumulated = m_AccumulatedY + velocity;
+	int deltaY = static_cast<int>(accumulated);
+	if (deltaY < 1) return false;
+
+	// The whole drop must be through empty cells, or end on something we cannot
+	// enter; entering a liquid or gas on the way is left to the per-element path
+	int distance = 0;
+	while (distance < deltaY && matrix.isEmpty(x, bottomY + 1 + distance)) {
+		++distance;
+	}
+	if (distance < deltaY && derived().canSwapWithElement(matrix, x, bottomY + 1 + distance)) {
+		return false;
+	}
+
+	m_IsMoving = true;
+	setMovedThisFrame(true);
+	m_VelocityY = velocity;
+	m_AccumulatedY = accumulated - distance;
+
+	// Extend the run upwards. Each element is handed the velocity of the one
+	// below, gains gravity and joins if it would fall at least as far; it then
+	// stops right on top of the one below, as it would after its own probe
+	int topY = bottomY;
+	while (true) {
+		Element* above = matrix.getElement(x, topY - 1);
+		if (above->getType() != getType() || above->getHasUpdated()) break;
+		// A different movable on top would make it try buoyancy first
+		Element* onTop = matrix.getElement(x, topY - 2);
+		if (onTop->getType() != getType() && onTop->template as<MovableElement>()) break;
+
+		TDerived* element = static_cast<TDerived*>(above);
+		float elementVelocity = std::clamp(velocity + GRAVITY, -32.0f, 32.0f);
+		float elementAccumulated = element->m_AccumulatedY + elementVelocity;
+		if (static_cast<int>(elementAccumulated) < distance) break;
+
+		element->m_IsMoving = true;
+		element->setMovedThisFrame(true);
+		element->m_VelocityY = elementVelocity;
+		element->m_AccumulatedY = elementAccumulated - distance;
+		velocity = elementVelocity;
+		--topY;
+	}
+
+	// The top of the run hands its velocity on, like the last swap would have
+	if (auto movable = matrix.getElement(x, topY - 1)->template as<MovableElement>()) {
+		movable->setVelocityY(velocity);
+	}
+
+	matrix.shiftColumnDown(x, topY, bottomY, distance);
+
+	for (int y = topY + distance; y <= bottomY + distance; ++y) {
+		static_cast<TDerived*>(matrix.getElement(x, y))->affectAdjacentNeighbors(matrix);
+	}
+	return true;
+}
+
 #endif // FALLING_ELEMENT_HPP
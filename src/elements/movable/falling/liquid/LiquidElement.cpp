@@ -5,12 +5,13 @@
 
 #include "src/elements/movable/falling/liquid/LiquidElement.hpp"
 #include "src/elements/movable/falling/powder/PowderElement.hpp"
+#include "src/core/CellularMatrix.hpp"
 
-bool LiquidElement::canSwapWithElement(IMatrix& matrix, int x, int y) const {
-	if (!matrix.isInBounds(x, y)) return false;
+template<typename TMatrix>
+bool LiquidElement::canSwapWithElement(TMatrix& matrix, int x, int y) const {
 	if (matrix.isEmpty(x, y)) return true;
 
-	auto target = matrix.getElement(x, y);
+	Element* target = matrix.getElement(x, y);
 	if (getType() == target->getType()) return false;
 
 	if (auto movable = target->as<MovableElement>()) {
@@ -20,7 +21,8 @@ bool LiquidElement::canSwapWithElement(IMatrix& matrix, int x, int y) const {
 	return false;
 }
 
-void LiquidElement::handleHorizontalSpreading(IMatrix& matrix) {
+template<typename TMatrix>
+void LiquidElement::handleHorizontalSpreading(TMatrix& matrix) {
 	int x = m_PosX;
 	int y = m_PosY;
 
@@ -44,11 +46,12 @@ void LiquidElement::handleHorizontalSpreading(IMatrix& matrix) {
 	int directions[2] = { goRightFirst ? 1 : -1, goRightFirst ? -1 : 1 };
 
 	// Weighted random: higher probability for farther distances
-	int totalWeight = (m_DispersionRate * (m_DispersionRate + 1)) / 2;
+	const int dispersionRate = getProperties().dispersionRate;
+	int totalWeight = (dispersionRate * (dispersionRate + 1)) / 2;
 	int r = ElementRNG::getRandomInt(1, totalWeight);
 	int chosenDistance = 1;
 	int acc = 0;
-	for (int i = 1; i <= m_DispersionRate; ++i) {
+	for (int i = 1; i <= dispersionRate; ++i) {
 		acc += i;
 		if (r <= acc) {
 			chosenDistance = i;
@@ -56,51 +59,76 @@ void LiquidElement::handleHorizontalSpreading(IMatrix& matrix) {
 		}
 	}
 
+	// Flow as far as the chosen distance allows, then down any drop-off there,
+	// unless the drop is deeper than maxDrop
+	const int maxDrop = 20;
 	for (int d = 0; d < 2; ++d) {
 		int sign = directions[d];
-		int lastValidX = x;
-		bool found = false;
-		for (int i = 1; i <= chosenDistance; ++i) {
-			int checkX = x + sign * i;
-			if (canSwapWithElement(matrix, checkX, y)) {
-				lastValidX = checkX;
-				found = true;
-			} else {
-				break;
+		int reach = countSwappable(matrix, x, y, sign, 0, chosenDistance);
+		if (reach > 0) {
+			int lastValidX = x + sign * reach;
+			int drop = countSwappable(matrix, lastValidX, y, 0, 1, maxDrop + 1);
+			if (drop > maxDrop) {
+				return;
 			}
-		}
-		if (found && lastValidX != x) {
-			int lowestY = y;
-			while (canSwapWithElement(matrix, lastValidX, lowestY + 1)) {
-				++lowestY;
-				if (lowestY - y > 20) {
-					return;
-				}
-			}
-			swapWithElement(matrix, lastValidX, lowestY);
+			swapWithElement(matrix, lastValidX, y + drop);
 			return; // Only spread in one direction per update
 		}
 	}
 }
 
-void LiquidElement::update(IMatrix& matrix) {
+template<typename TMatrix>
+int LiquidElement::countSwappable(TMatrix& matrix, int x, int y, int dx, int dy, int maxCount) const {
+	int count = 0;
+	if constexpr (std::is_same_v<TMatrix, CellularMatrix>) {
+		count = dy ? matrix.countEmptyBelow(x, y + 1, maxCount)
+				   : matrix.countEmptyInRow(x + dx, y, dx, maxCount);
+	}
+	while (count < maxCount && canSwapWithElement(matrix, x + dx * (count + 1), y + dy * (count + 1))) {
+		++count;
+	}
+	return count;
+}
+
+template<typename TMatrix>
+void LiquidElement::updateLiquid(TMatrix& matrix) {
 	if (checkIfUpdated()) return;
 	handleBuoyancy(matrix);
 	handleFalling(matrix);
+
+	// Moving wakes the neighborhood anyway. Liquid that did not move stays
+	// awake while it is still gathering speed to fall, has room to spread,
+	// or lies under a denser liquid
+	int x = m_PosX, y = m_PosY;
+	if (canSwapWithElement(matrix, x, y + 1) ||
+		canSwapWithElement(matrix, x - 1, y) ||
+		canSwapWithElement(matrix, x + 1, y) ||
+		isUnderDenserLiquid(matrix)) {
+		matrix.activateChunk(x, y);
+	}
+}
+
+template<typename TMatrix>
+bool LiquidElement::isUnderDenserLiquid(TMatrix& matrix) const {
+	Element* target = matrix.getElement(m_PosX, m_PosY - 1);
+	if (target->getType() == getType()) return false;
+	auto above = target->as<LiquidElement>();
+	return above && above->getDensity() > getDensity();
 }
 
 void LiquidElement::recieveNeighborEffect() {
 	return;
 }
 
-void LiquidElement::handleGrounded(IMatrix& matrix) {
+template<typename TMatrix>
+void LiquidElement::handleGrounded(TMatrix& matrix) {
 	handleHorizontalSpreading(matrix);
 }
 
-void LiquidElement::handleBuoyancy(IMatrix& matrix) {
+template<typename TMatrix>
+void LiquidElement::handleBuoyancy(TMatrix& matrix) {
 	int x = m_PosX, y = m_PosY;
-	auto target = matrix.isInBounds(x, y - 1) ? matrix.getElement(x, y - 1) : nullptr;
-	if (!target && target->getHasUpdated()) return;
+	Element* target = matrix.getElement(x, y - 1);
 	if (auto above = target->as<MovableElement>()) {
 		if (getType() == above->getType()) return;
 		if (!above->as<LiquidElement>()) return;
@@ -111,4 +139,8 @@ void LiquidElement::handleBuoyancy(IMatrix& matrix) {
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+
+// Entry points instantiate the kernel for the generic interface and for the concrete matrix
+void LiquidElement::update(IMatrix& matrix) { updateLiquid(matrix); }
+void LiquidElement::update(CellularMatrix& matrix) { updateLiquid(matrix); }
\ No newline at end of file
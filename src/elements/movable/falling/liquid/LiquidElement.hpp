@@ -9,7 +9,7 @@
  * Inherits from FallingElement and BuoyantElement to provide gravity, movement,
  * and density-based interactions.
  */
-class LiquidElement : public FallingElement {
+class LiquidElement : public FallingElement<LiquidElement> {
 public:
 	/**
 	 * @brief Construct a new LiquidElement.
@@ -24,8 +24,14 @@ public:
 	 * @param matrix The simulation matrix.
 	 */
 	void update(IMatrix& matrix) override;
+	void update(CellularMatrix& matrix) override;
 
 protected:
+	friend class FallingElement<LiquidElement>;
+
+	template<typename TMatrix>
+	void updateLiquid(TMatrix& matrix);
+
 	/**
 	 * @brief Determine if this liquid can swap with the element at (x, y).
 	 * @param matrix The simulation matrix.
@@ -33,23 +39,40 @@ protected:
 	 * @param y The y-coordinate to check.
 	 * @return True if swap is allowed, false otherwise.
 	 */
-	bool canSwapWithElement(IMatrix& matrix, int x, int y) const override;
+	template<typename TMatrix>
+	bool canSwapWithElement(TMatrix& matrix, int x, int y) const;
 
 	/**
 	 * @brief Handles horizontal spreading and dispersion of the liquid.
 	 * @param matrix The simulation matrix.
 	 */
-	void handleHorizontalSpreading(IMatrix& matrix);
+	template<typename TMatrix>
+	void handleHorizontalSpreading(TMatrix& matrix);
+
+	/**
+	 * @brief Count the cells this liquid could move into one after another,
+	 * stepping from (x, y) by (dx, dy), up to maxCount.
+	 *
+	 * On CellularMatrix the leading run of EMPTY cells is read from the chunk
+	 * occupancy masks; only cells past it are probed one by one.
+	 */
+	template<typename TMatrix>
+	int countSwappable(TMatrix& matrix, int x, int y, int dx, int dy, int maxCount) const;
 
 	void recieveNeighborEffect() override;
-	void handleGrounded(IMatrix& matrix) override;
 
-	void handleBuoyancy(IMatrix& matrix) override;
+	template<typename TMatrix>
+	void handleGrounded(TMatrix& matrix);
+
+	template<typename TMatrix>
+	void handleBuoyancy(TMatrix& matrix);
 
 	/**
-	 * @brief The maximum distance the liquid can spread horizontally per update.
+	 * @brief Whether a denser liquid lies on this one, which handleBuoyancy
+	 * may randomly swap with.
 	 */
-	int m_DispersionRate = 32;
+	template<typename TMatrix>
+	bool isUnderDenserLiquid(TMatrix& matrix) const;
 };
 
 #endif // LIQUID_ELEMENT_HPP
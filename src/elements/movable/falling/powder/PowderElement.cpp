@@ -1,12 +1,13 @@
 #include "src/elements/movable/falling/powder/PowderElement.hpp"
 #include "src/elements/movable/falling/liquid/LiquidElement.hpp"
 #include "src/elements/movable/rising/gas/GasElement.hpp"
+#include "src/core/CellularMatrix.hpp"
 
-bool PowderElement::canSwapWithElement(IMatrix& matrix, int x, int y) const {
-	if (!matrix.isInBounds(x, y)) return false;
+template<typename TMatrix>
+bool PowderElement::canSwapWithElement(TMatrix& matrix, int x, int y) const {
 	if (matrix.isEmpty(x, y)) return true;
 
-	auto target = matrix.getElement(x, y);
+	Element* target = matrix.getElement(x, y);
 	if (getType() == target->getType()) return false;
 
 	if (target->as<LiquidElement>()) return true;
@@ -15,13 +16,14 @@ bool PowderElement::canSwapWithElement(IMatrix& matrix, int x, int y) const {
 }
 
 void PowderElement::recieveNeighborEffect() {
-	if (!ElementRNG::getRandomChance(m_InertialResistance)) {
+	if (!ElementRNG::getRandomChance(getProperties().inertialResistance)) {
 		setIsMoving(true);
 		return;
 	}
 }
 
-void PowderElement::handleGrounded(IMatrix& matrix) {
+template<typename TMatrix>
+void PowderElement::handleGrounded(TMatrix& matrix) {
 	if (!getIsMoving()) return;
 
 	int dir = ElementRNG::getRandomDirection(); // Randomly pick left or right
@@ -29,7 +31,7 @@ void PowderElement::handleGrounded(IMatrix& matrix) {
 	int x2 = m_PosX - dir;
 	int y1 = m_PosY + 1;
 
-	if (ElementRNG::getRandomChance(m_Friction)) {
+	if (ElementRNG::getRandomChance(getProperties().friction)) {
 		setIsMoving(false);
 		return;
 	}
@@ -45,15 +47,30 @@ void PowderElement::handleGrounded(IMatrix& matrix) {
 	}
 }
 
-void PowderElement::update(IMatrix& matrix) {
+template<typename TMatrix>
+void PowderElement::updatePowder(TMatrix& matrix) {
 	if (checkIfUpdated()) return;
 	handleBuoyancy(matrix);
 	handleFalling(matrix);
+
+	// A resting grain sleeps until something around it changes; one that is
+	// still sliding, or lighter than what lies on it, stays awake
+	if (getIsMoving() || isBuoyant(matrix)) {
+		matrix.activateChunk(m_PosX, m_PosY);
+	}
+}
+
+template<typename TMatrix>
+bool PowderElement::isBuoyant(TMatrix& matrix) const {
+	Element* target = matrix.getElement(m_PosX, m_PosY - 1);
+	auto above = target->as<MovableElement>();
+	return above && above->getDensity() > getDensity();
 }
 
-void PowderElement::handleBuoyancy(IMatrix& matrix) {
+template<typename TMatrix>
+void PowderElement::handleBuoyancy(TMatrix& matrix) {
 	int x = m_PosX, y = m_PosY;
-	auto target = matrix.isInBounds(x, y - 1) ? matrix.getElement(x, y - 1) : nullptr;
+	Element* target = matrix.getElement(x, y - 1);
 	if (auto above = target->as<MovableElement>()) {
 		float difference = getDensity() - above->getDensity();
 		if (difference < 0) {
@@ -84,4 +101,8 @@ void PowderElement::handleBuoyancy(IMatrix& matrix) {
 			}
 		}
 	}
-}
\ No newline at end of file
+}
+
+// Entry points instantiate the kernel for the generic interface and for the concrete matrix
+void PowderElement::update(IMatrix& matrix) { updatePowder(matrix); }
+void PowderElement::update(CellularMatrix& matrix) { updatePowder(matrix); }
\ No newline at end of file
@@ -6,10 +6,10 @@
 /**
  * @brief Represents a powder element that falls and interacts with friction and impact.
  * 
- * Inherits from FallingElement and adds properties for friction, impact absorption,
- * and inertial resistance.
+ * Inherits from FallingElement. Friction, impact absorption and inertial
+ * resistance come from the type's ElementProperties.
  */
-class PowderElement : public FallingElement {
+class PowderElement : public FallingElement<PowderElement> {
 public:
 	/**
 	 * @brief Construct a new PowderElement.
@@ -24,7 +24,13 @@ public:
 	 * @param matrix The simulation matrix.
 	 */
 	void update(IMatrix& matrix) override;
+	void update(CellularMatrix& matrix) override;
 protected:
+	friend class FallingElement<PowderElement>;
+
+	template<typename TMatrix>
+	void updatePowder(TMatrix& matrix);
+
 	/**
 	 * @brief Determine if this powder can swap with the element at (x, y).
 	 * @param matrix The simulation matrix.
@@ -32,7 +38,8 @@ protected:
 	 * @param y The y-coordinate to check.
 	 * @return True if swap is allowed, false otherwise.
 	 */
-	bool canSwapWithElement(IMatrix& matrix, int x, int y) const override;
+	template<typename TMatrix>
+	bool canSwapWithElement(TMatrix& matrix, int x, int y) const;
 
 	/**
 	 * @brief Respond to the movement of a neighboring element.
@@ -43,24 +50,18 @@ protected:
 	 * @brief Handle logic when the powder is grounded.
 	 * @param matrix The simulation matrix.
 	 */
-	void handleGrounded(IMatrix& matrix) override;
-
-	void handleBuoyancy(IMatrix&) override;
-
-	/**
-	 * @brief Friction coefficient for powder movement.
-	 */
-	float m_Friction = 0.1f;
+	template<typename TMatrix>
+	void handleGrounded(TMatrix& matrix);
 
-	/**
-	 * @brief Impact absorption factor for collisions.
-	 */
-	float m_ImpactAbsorption = 0.5f;
+	template<typename TMatrix>
+	void handleBuoyancy(TMatrix& matrix);
 
 	/**
-	 * @brief Inertial resistance to movement.
+	 * @brief Whether a denser movable element lies on this one, which
+	 * handleBuoyancy may randomly swap with.
 	 */
-	float m_InertialResistance = 0.0f;
+	template<typename TMatrix>
+	bool isBuoyant(TMatrix& matrix) const;
 };
 
 #endif // POWDER_ELEMENT_HPP
@@ -7,50 +7,67 @@
  * @brief Abstract base class for elements that rise due to negative gravity (buoyancy).
  *
  * Inherits from MovableElement and provides basic rising logic.
- * Derived classes must implement the `handleCeilinged` method to define behavior
- * when the element is no longer rising.
+ * Uses CRTP: TDerived must provide `canSwapWithElement` and `handleCeilinged`
+ * as member templates over the matrix type, which handleRising calls without
+ * virtual dispatch. TDerived befriends RisingElement<TDerived> to expose them.
  */
+template<typename TDerived>
 class RisingElement : public MovableElement {
 protected:
 	// ========== Construction ==========
 	RisingElement(ElementType type, int x, int y) : MovableElement(type, x, y) {}
 
-	/**
-	 * @brief Determine whether this element can swap with another at the given coordinates.
-	 *
-	 * Must be overridden in derived classes to define specific rules.
-	 */
-	bool canSwapWithElement(IMatrix& matrix, int x, int y) const override = 0;
-
-	/**
-	 * @brief React to the movement of a neighboring element.
-	 *
-	 * Default implementation does nothing. Can be overridden in subclasses.
-	 */
-	void recieveNeighborEffect() override = 0;
-
 	/**
 	 * @brief Handles the logic for rising movement (negative gravity).
 	 *
 	 * Applies negative gravity, velocity, and collision detection, and updates position accordingly.
+	 * When the element cannot rise, TDerived::handleCeilinged is called.
 	 *
 	 * @param matrix The simulation matrix.
 	 */
-	void handleRising(IMatrix& matrix);
+	template<typename TMatrix>
+	void handleRising(TMatrix& matrix);
 
-	/**
-	 * @brief Called when the element is considered "ceilinged" (can't rise further).
-	 *
-	 * Subclasses must define how ceilinged elements behave.
-	 *
-	 * @param matrix The simulation matrix.
-	 */
-	virtual void handleCeilinged(IMatrix& matrix) = 0;
-
-	void handleBuoyancy(IMatrix& matrix) override = 0;
+private:
+	TDerived& derived() { return static_cast<TDerived&>(*this); }
+};
 
-	float m_ChanceOfHorizontal = 0.5f;
+template<typename TDerived>
+template<typename TMatrix>
+void RisingElement<TDerived>::handleRising(TMatrix& matrix) {
+	int x = m_PosX, y = m_PosY;
+	if (!ElementRNG::getRandomChance(getProperties().chanceOfHorizontal)) {
+		if (derived().canSwapWithElement(matrix, x, y - 1)) {
+			swapWithElement(matrix, x, y - 1);
+			return;
+		}
+	}
+	else {
+		int direction = ElementRNG::getRandomDirection();
+		
+		if (derived().canSwapWithElement(matrix, x + direction, y - 1)) {
+			swapWithElement(matrix, x + direction, y - 1);
+			return;
+		}
+		else if (derived().canSwapWithElement(matrix, x - direction, y - 1)) {
+			swapWithElement(matrix, x - direction, y - 1);
+			return;
+		}
+		else if (derived().canSwapWithElement(matrix, x + direction, y)) {
+			swapWithElement(matrix, x + direction, y);
+			return;
+		}
+		else if (derived().canSwapWithElement(matrix, x - direction, y)) {
+			swapWithElement(matrix, x - direction, y);
+			return;
+		}
+	}
 
-};
+	// Can't rise further or no upward movement
+	m_VelocityY = 0.0f;
+	m_AccumulatedY = 0.0f;
+	setIsMoving(false);
+	derived().handleCeilinged(matrix);
+}
 
 #endif // RISING_ELEMENT_HPP
@@ -1,9 +1,10 @@
 #include "src/elements/movable/rising/gas/GasElement.hpp"
+#include "src/core/CellularMatrix.hpp"
+#include <type_traits>
 
-bool GasElement::canSwapWithElement(IMatrix& matrix, int x, int y) const {
-	if (!matrix.isInBounds(x, y)) return false;
+template<typename TMatrix>
+bool GasElement::canSwapWithElement(TMatrix& matrix, int x, int y) const {
 	Element* target = matrix.getElement(x, y);
-	if (!target) return matrix.isEmpty(x, y);
 	// Can't replace updated targets
 	if (target->getHasUpdated()) return false;
 	// Can't replace same type
@@ -18,7 +19,8 @@ void GasElement::recieveNeighborEffect() {
 	setIsMoving(true);
 }
 
-void GasElement::handleCeilinged(IMatrix& matrix) {
+template<typename TMatrix>
+void GasElement::handleCeilinged(TMatrix& matrix) {
 	// When ceilinged, try to spread horizontally (left or right)
 	int left = m_PosX - 1;
 	int right = m_PosX + 1;
@@ -38,17 +40,48 @@ void GasElement::handleCeilinged(IMatrix& matrix) {
 	}
 }
 
-void GasElement::update(IMatrix& matrix) {
+template<typename TMatrix>
+bool GasElement::hasRoomToMove(TMatrix& matrix) const {
+	int x = m_PosX, y = m_PosY;
+	return matrix.isEmpty(x, y - 1) ||
+		matrix.isEmpty(x - 1, y - 1) || matrix.isEmpty(x + 1, y - 1) ||
+		matrix.isEmpty(x - 1, y) || matrix.isEmpty(x + 1, y);
+}
+
+template<typename TMatrix>
+void GasElement::updateGas(TMatrix& matrix) {
 	if (checkIfUpdated()) return;
-	matrix.activateChunk(m_PosX, m_PosY);
-
-	m_TimeUntilDeath--;
-	if (m_TimeUntilDeath < 0) {
-		if (ElementRNG::getRandomChance(m_ChanceOfDeathAfterTimer)) {
-			destroySelf(matrix);
-			return;
-		}
+
+	// With the coarse gas field enabled, the gas leaves the cell grid for it
+	if constexpr (std::is_same_v<TMatrix, CellularMatrix>) {
+		if (matrix.absorbGas(m_PosX, m_PosY)) return;
+	}
+
+	// The lifetime plus the per-tick chance to dissipate after it, drawn once
+	uint64_t now = matrix.getTick();
+	if (m_DeathTick == NO_TICK) {
+		const ElementProperties& properties = getProperties();
+		int extra = ElementRNG::getFailuresBeforeChance(properties.chanceOfDeathAfterLifetime);
+		m_DeathTick = extra == INT_MAX ? NO_TICK - 1 : now + properties.lifetime + extra;
+	}
+	if (now >= m_DeathTick) {
+		destroySelf(matrix);
+		return;
 	}
 
 	handleRising(matrix);
-}
\ No newline at end of file
+
+	// A gas with room to move stays awake. A boxed-in one sleeps, and a
+	// scheduled wake-up at its death tick replaces counting down every tick
+	if (hasRoomToMove(matrix)) {
+		matrix.activateChunk(m_PosX, m_PosY);
+	} else if (m_PosX != m_WakeX || m_PosY != m_WakeY) {
+		matrix.scheduleWake(m_PosX, m_PosY, m_DeathTick - now);
+		m_WakeX = m_PosX;
+		m_WakeY = m_PosY;
+	}
+}
+
+// Entry points instantiate the kernel for the generic interface and for the concrete matrix
+void GasElement::update(IMatrix& matrix) { updateGas(matrix); }
+void GasElement::update(CellularMatrix& matrix) { updateGas(matrix); }
\ No newline at end of file
@@ -2,13 +2,15 @@
 #define GAS_ELEMENT_HPP
 
 #include "src/elements/movable/rising/RisingElement.hpp"
+#include <climits>
+#include <cstdint>
 
 /**
  * @brief Represents a gas element that rises due to buoyancy and interacts by density.
  * 
  * Inherits from RisingElement and BuoyantElement.
  */
-class GasElement : public RisingElement {
+class GasElement : public RisingElement<GasElement> {
 public:
 	/**
 	 * @brief Construct a new GasElement.
@@ -23,7 +25,13 @@ public:
 	 * @param matrix The simulation matrix.
 	 */
 	void update(IMatrix& matrix) override;
+	void update(CellularMatrix& matrix) override;
 protected:
+	friend class RisingElement<GasElement>;
+
+	template<typename TMatrix>
+	void updateGas(TMatrix& matrix);
+
 	/**
 	 * @brief Determine if this gas can swap with the element at (x, y).
 	 * @param matrix The simulation matrix.
@@ -31,7 +39,8 @@ protected:
 	 * @param y The y-coordinate to check.
 	 * @return True if swap is allowed, false otherwise.
 	 */
-	bool canSwapWithElement(IMatrix& matrix, int x, int y) const override;
+	template<typename TMatrix>
+	bool canSwapWithElement(TMatrix& matrix, int x, int y) const;
 
 	/**
 	 * @brief Respond to the movement of a neighboring element.
@@ -42,12 +51,18 @@ protected:
 	 * @brief Handle logic when the gas is "ceilinged" (can't rise further).
 	 * @param matrix The simulation matrix.
 	 */
-	void handleCeilinged(IMatrix& matrix) override;
+	template<typename TMatrix>
+	void handleCeilinged(TMatrix& matrix);
 
-	void handleBuoyancy(IMatrix&) override { return; }
+	/**
+	 * @brief Whether any cell the gas could rise or spread into is empty.
+	 */
+	template<typename TMatrix>
+	bool hasRoomToMove(TMatrix& matrix) const;
 
-	int m_TimeUntilDeath = 100;
-	float m_ChanceOfDeathAfterTimer = 0.01f;
+	uint64_t m_DeathTick = NO_TICK;  ///< Tick the gas dissipates on, drawn on its first update
+	int m_WakeX = INT_MIN;           ///< Where the death wake-up was last scheduled
+	int m_WakeY = INT_MIN;
 };
 
 #endif // GAS_ELEMENT_HPP
@@ -12,6 +12,9 @@ class StaticElement : public Element {
 public:
 	StaticElement(ElementType type, int x, int y) : Element(type, x, y) {}
 
+	// Subclasses that do override update must set this back to false
+	static constexpr bool IS_INERT = true;
+
 	/**
 	 * @brief Update method for static elements (does nothing).
 	 * @param matrix The simulation matrix.
@@ -19,6 +22,7 @@ public:
 	void update(IMatrix& /*matrix*/) override {
 		// Static elements do not update/move.
 	}
+	void update(CellularMatrix& /*matrix*/) override {}
 };
 
 #endif // STATIC_ELEMENT_HPP
@@ -5,9 +5,7 @@
 
 class Ash : public PowderElement {
 public:
-	Ash(int x, int y) : PowderElement(ElementType::ASH, x, y) {
-		m_Density = 0.1f;
-	}
+	Ash(int x, int y) : PowderElement(ElementType::ASH, x, y) {}
 };
 
 #endif // ASH_HPP
@@ -5,11 +5,7 @@
 
 class Coal : public PowderElement {
 public:
-	Coal(int x, int y) : PowderElement(ElementType::COAL, x, y) {
-		m_Density = 0.9f;
-		m_Friction = 0.2f;
-		m_InertialResistance = 0.3f;
-	}
+	Coal(int x, int y) : PowderElement(ElementType::COAL, x, y) {}
 };
 
 #endif // COAL_HPP
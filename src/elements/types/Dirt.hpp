@@ -5,11 +5,7 @@
 
 class Dirt : public PowderElement {
 public:
-	Dirt(int x, int y) : PowderElement(ElementType::DIRT, x, y) {
-		m_Density = 0.85f;
-		m_Friction = 0.2f;
-		m_InertialResistance = 0.5f;
-	}
+	Dirt(int x, int y) : PowderElement(ElementType::DIRT, x, y) {}
 };
 
 #endif // DIRT_HPP
@@ -5,9 +5,7 @@
 
 class Oil : public LiquidElement {
 public:
-	Oil(int x, int y) : LiquidElement(ElementType::OIL, x, y) {
-		m_Density = 0.4f;
-	}
+	Oil(int x, int y) : LiquidElement(ElementType::OIL, x, y) {}
 };
 
 #endif // OIL_HPP
@@ -2,20 +2,10 @@
 #define SALT_HPP
 
 #include "src/elements/movable/falling/powder/PowderElement.hpp"
-#include "src/elements/traits/DissolvableElement.hpp"
 
-class Salt : public PowderElement, DissolvableElement {
+class Salt : public PowderElement {
 public:
-	Salt(int x, int y) : PowderElement(ElementType::SALT, x, y) {
-		m_Density = 0.2f;
-		m_Solvents = {
-			{WATER, 0.005f}
-		};
-	}
-	void update(IMatrix& matrix) override {
-		PowderElement::update(matrix);
-		handleDissolving(matrix, m_PosX, m_PosY);
-	}
+	Salt(int x, int y) : PowderElement(ElementType::SALT, x, y) {}
 };
 
 #endif // SALT_HPP
@@ -5,11 +5,7 @@
 
 class Sand : public PowderElement {
 public:
-	Sand(int x, int y) : PowderElement(ElementType::SAND, x, y) {
-		m_Density = 0.8f;
-		m_Friction = 0.035f;
-		m_InertialResistance = 0.0f;
-	}
+	Sand(int x, int y) : PowderElement(ElementType::SAND, x, y) {}
 };
 
 #endif // SAND_HPP
@@ -5,9 +5,7 @@
 
 class Smoke : public GasElement {
 public:
-	Smoke(int x, int y) : GasElement(ElementType::SMOKE, x, y) {
-		m_Density = 0.05f;
-	}
+	Smoke(int x, int y) : GasElement(ElementType::SMOKE, x, y) {}
 };
 
 #endif // SMOKE_HPP
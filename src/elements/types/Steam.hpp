@@ -5,9 +5,7 @@
 
 class Steam : public GasElement {
 public:
-	Steam(int x, int y) : GasElement(ElementType::STEAM, x, y) {
-		m_Density = 0.02f;
-	}
+	Steam(int x, int y) : GasElement(ElementType::STEAM, x, y) {}
 };
 
 #endif // STEAM_HPP
@@ -0,0 +1,12 @@
+#ifndef WALL_HPP
+#define WALL_HPP
+
+#include "src/elements/static/StaticElement.hpp"
+
+// Immutable border cell surrounding the world; never placed by the user
+class Wall : public StaticElement {
+public:
+	Wall(int x, int y) : StaticElement(ElementType::WALL, x, y) {}
+};
+
+#endif // WALL_HPP
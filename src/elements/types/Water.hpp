@@ -2,14 +2,10 @@
 #define WATER_HPP
 
 #include "src/elements/movable/falling/liquid/LiquidElement.hpp"
-#include "src/elements/traits/SolvantElement.hpp"
 
-class Water : public LiquidElement, SolvantElement {
+class Water : public LiquidElement {
 public:
-	Water(int x, int y) : LiquidElement(ElementType::WATER, x, y) {
-		m_Density = 0.5f;
-		m_DissolvedElement = EMPTY;
-	}
+	Water(int x, int y) : LiquidElement(ElementType::WATER, x, y) {}
 };
 
 #endif // WATER_HPP
@@ -0,0 +1,49 @@
+// src/elements/utilities/pool/ElementPool.cpp
+#include "src/elements/utilities/pool/ElementPool.hpp"
+#include <new>
+
+// Static member definitions
+std::array<ElementPool::FreeCell*, ElementPool::CLASS_COUNT> ElementPool::s_FreeLists {};
+std::vector<void*> ElementPool::s_Slabs;
+
+void* ElementPool::allocate(size_t size) {
+	if (size > MAX_POOLED_SIZE) {
+		return ::operator new(size);
+	}
+	size_t sizeClass = classOf(size);
+	if (!s_FreeLists[sizeClass]) {
+		refill(sizeClass);
+	}
+	FreeCell* cell = s_FreeLists[sizeClass];
+	s_FreeLists[sizeClass] = cell->next;
+	return cell;
+}
+
+void ElementPool::deallocate(void* pointer, size_t size) {
+	if (!pointer) return;
+	if (size > MAX_POOLED_SIZE) {
+		::operator delete(pointer);
+		return;
+	}
+	size_t sizeClass = classOf(size);
+	FreeCell* cell = static_cast<FreeCell*>(pointer);
+	cell->next = s_FreeLists[sizeClass];
+	s_FreeLists[sizeClass] = cell;
+}
+
+// Carves a new slab into cells of one class, threaded in address order so
+// consecutive allocations (a chunk being filled) sit next to each other
+void ElementPool::refill(size_t sizeClass) {
+	size_t cellSize = (sizeClass + 1) * GRANULARITY;
+	char* slab = static_cast<char*>(::operator new(SLAB_SIZE));
+	s_Slabs.push_back(slab);
+
+	size_t cellCount = SLAB_SIZE / cellSize;
+	FreeCell* head = nullptr;
+	for (size_t i = cellCount; i-- > 0;) {
+		FreeCell* cell = reinterpret_cast<FreeCell*>(slab + i * cellSize);
+		cell->next = head;
+		head = cell;
+	}
+	s_FreeLists[sizeClass] = head;
+}
@@ -1,6 +1,8 @@
 // src/elements/utilities/rng/ElementRNG.cpp
 #include "src/elements/utilities/rng/ElementRNG.hpp"
 #include <algorithm>
+#include <climits>
+#include <cmath>
 
 // Static member definitions
 std::mt19937 ElementRNG::s_RNG{std::random_device{}()};
@@ -26,4 +28,12 @@ int ElementRNG::getRandomInt(int min, int max) {
 float ElementRNG::getRandomFloat(float min, float max) {
 	std::uniform_real_distribution<float> dist(min, max);
 	return dist(s_RNG);
+}
+
+int ElementRNG::getFailuresBeforeChance(float percentage) {
+	percentage = std::clamp(percentage, 0.0f, 1.0f);
+	if (percentage >= 1.0f) return 0;
+	if (percentage <= 0.0f) return INT_MAX;
+	std::geometric_distribution<int> dist(percentage);
+	return dist(s_RNG);
 }
\ No newline at end of file
@@ -46,6 +46,16 @@ public:
 	 */
 	static float getRandomFloat(float min, float max);
 
+	/**
+	 * @brief Returns how many getRandomChance(percentage) calls in a row would
+	 * fail before the first success (geometric distribution).
+	 * 
+	 * Lets a per-update chance be drawn once up front.
+	 * @param percentage A value between 0.0 and 1.0 representing the per-call probability.
+	 * @return The number of failures, or INT_MAX for a zero chance.
+	 */
+	static int getFailuresBeforeChance(float percentage);
+
 private:
 	/// Random number generator instance (shared by all calls).
 	static std::mt19937 s_RNG;
@@ -4,6 +4,13 @@
 // Define static members
 Particle ParticleManager::m_Particles[s_MAX_PARTICLES]{};
 size_t ParticleManager::m_Count = 0;
+int ParticleManager::m_BoundsWidth = Matrix::DEFAULT_WIDTH;
+int ParticleManager::m_BoundsHeight = Matrix::DEFAULT_HEIGHT;
+
+void ParticleManager::setBounds(int width, int height) {
+	m_BoundsWidth = width;
+	m_BoundsHeight = height;
+}
 
 // Add a particle, returns true if successful
 bool ParticleManager::spawnParticle(const Particle p) {
@@ -45,8 +52,8 @@ void ParticleManager::updateParticles() {
 		p.lifetime--;
 
 		bool outOfBounds = 
-			p.x + p.width  < 0 || p.x >= Matrix::WIDTH ||
-			p.y + p.height < 0 || p.y >= Matrix::HEIGHT;
+			p.x + p.width  < 0 || p.x >= m_BoundsWidth ||
+			p.y + p.height < 0 || p.y >= m_BoundsHeight;
 
 		float fadeThreshold = p.maxLifetime * p.fadeThreshold;
 		p.color.a = static_cast<Uint8>(p.alpha *
@@ -110,9 +110,14 @@ public:
 
 	static void updateParticles();
 
+	// World bounds; particles leaving them are removed
+	static void setBounds(int width, int height);
+
 private:
 	static Particle m_Particles[s_MAX_PARTICLES];
 	static size_t m_Count;
+	static int m_BoundsWidth;
+	static int m_BoundsHeight;
 };
 
 
@@ -1,4 +1,5 @@
 #include "src/ui/DebugUI.hpp"
+#include <algorithm>
 #include <iostream>
 
 //------------------------------------------------------------------------------
@@ -31,10 +32,12 @@ bool DebugUI::initialize() {
 // Update and Render
 //------------------------------------------------------------------------------
 
-void DebugUI::update(Uint32 currentTime, int activeChunks, int totalChunks) {
+void DebugUI::update(Uint32 currentTime, int activeChunks, int totalChunks, const FrameStats& stats) {
 	// Update FPS and chunk stats every 250ms
 	++m_FrameCount;
 
+	rebuildGraph(stats);
+
 	if (currentTime - m_FpsLastTime >= 250) {
 		m_Fps = m_FrameCount * 1000.f /
 			   static_cast<float>(currentTime - m_FpsLastTime);
@@ -46,7 +49,8 @@ void DebugUI::update(Uint32 currentTime, int activeChunks, int totalChunks) {
 						  "\nChunks: " +
 						  std::to_string(activeChunks) + "/" +
 						  std::to_string(totalChunks) + " " +
-						  std::to_string(100 * activeChunks / totalChunks) + "%";
+						  std::to_string(100 * activeChunks / totalChunks) + "%" +
+						  "\n" + stats.formatSummary();
 
 		rebuildTextTexture(txt);
 	}
@@ -57,6 +61,19 @@ void DebugUI::render(bool debugEnabled) {
 	if (!debugEnabled || !mp_TextTexture)
 		return;
 	SDL_RenderCopy(mp_Renderer, mp_TextTexture, nullptr, &m_DstRect);
+
+	// Frame-time graph: translucent background, one bar per frame, budget line
+	SDL_SetRenderDrawBlendMode(mp_Renderer, SDL_BLENDMODE_BLEND);
+	SDL_SetRenderDrawColor(mp_Renderer, 0, 0, 0, 128);
+	SDL_RenderFillRect(mp_Renderer, &m_GraphBounds);
+
+	SDL_SetRenderDrawColor(mp_Renderer, 0, 255, 0, 255);
+	SDL_RenderFillRects(mp_Renderer, m_GraphBars.data(), static_cast<int>(m_GraphBars.size()));
+
+	int budgetY = m_GraphBounds.y + m_GraphBounds.h -
+				  static_cast<int>(GRAPH_HEIGHT * GRAPH_BUDGET_MS / GRAPH_MAX_MS);
+	SDL_SetRenderDrawColor(mp_Renderer, 255, 255, 0, 255);
+	SDL_RenderDrawLine(mp_Renderer, m_GraphBounds.x, budgetY, m_GraphBounds.x + m_GraphBounds.w, budgetY);
 }
 
 //------------------------------------------------------------------------------
@@ -83,4 +100,21 @@ void DebugUI::rebuildTextTexture(const std::string &text) {
 		m_DstRect = {TEXT_POS_X, TEXT_POS_Y, surf->w, surf->h};
 	}
 	SDL_FreeSurface(surf);
+}
+
+void DebugUI::rebuildGraph(const FrameStats& stats) {
+	// Lay the graph out just below the debug text, newest frame on the right
+	m_GraphBounds = {TEXT_POS_X, m_DstRect.y + m_DstRect.h + TEXT_POS_Y, GRAPH_SAMPLES, GRAPH_HEIGHT};
+	m_GraphBars.clear();
+
+	int count = stats.getSampleCount(FrameStats::FRAME);
+	int first = std::max(0, count - GRAPH_SAMPLES);
+	int baseX = m_GraphBounds.x + GRAPH_SAMPLES - (count - first);
+	int bottom = m_GraphBounds.y + m_GraphBounds.h;
+
+	for (int i = first; i < count; ++i) {
+		float ms = std::min(stats.getSample(FrameStats::FRAME, i), GRAPH_MAX_MS);
+		int h = std::max(1, static_cast<int>(GRAPH_HEIGHT * ms / GRAPH_MAX_MS));
+		m_GraphBars.push_back({baseX + (i - first), bottom - h, 1, h});
+	}
 }
\ No newline at end of file
@@ -5,11 +5,14 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <string>
+#include <vector>
+#include "src/core/FrameStats.hpp"
 
 /**
  * @brief UI overlay for displaying debug information (FPS, chunk stats, etc.).
  * 
- * Handles text rendering and updating debug stats.
+ * Handles text rendering and updating debug stats, including frame-time
+ * percentiles and a small frame-time graph fed from FrameStats.
  */
 class DebugUI {
 public:
@@ -35,8 +38,9 @@ public:
 	 * @param currentTime Current SDL ticks
 	 * @param activeChunks Number of active chunks
 	 * @param totalChunks Total number of chunks
+	 * @param stats Rolling frame-time statistics
 	 */
-	void update(Uint32 currentTime, int activeChunks, int totalChunks);
+	void update(Uint32 currentTime, int activeChunks, int totalChunks, const FrameStats& stats);
 
 	/**
 	 * @brief Render the debug overlay (call after all other rendering).
@@ -48,6 +52,10 @@ public:
 	static constexpr int FONT_SIZE = 16;      ///< Font size for debug text
 	static constexpr int TEXT_POS_X = 10;     ///< X position for debug text
 	static constexpr int TEXT_POS_Y = 10;     ///< Y position for debug text
+	static constexpr int GRAPH_SAMPLES = 240;     ///< Frames shown in the frame-time graph
+	static constexpr int GRAPH_HEIGHT = 60;       ///< Graph height in pixels
+	static constexpr float GRAPH_MAX_MS = 50.0f;  ///< Frame time mapped to the full graph height
+	static constexpr float GRAPH_BUDGET_MS = 1000.0f / 60.0f; ///< Reference line (60 FPS budget)
 
 private:
 	/**
@@ -56,6 +64,12 @@ private:
 	 */
 	void rebuildTextTexture(const std::string& text);
 
+	/**
+	 * @brief Rebuild the frame-time graph bars from the latest samples.
+	 * @param stats Rolling frame-time statistics
+	 */
+	void rebuildGraph(const FrameStats& stats);
+
 	SDL_Renderer* mp_Renderer;    ///< SDL renderer pointer
 	TTF_Font* mp_Font {nullptr};   ///< Loaded font
 	SDL_Texture* mp_TextTexture {nullptr}; ///< Texture for rendered debug text
@@ -64,6 +78,9 @@ private:
 	Uint32 m_FpsLastTime {0};     ///< Last time FPS was calculated
 	int m_FrameCount {0};         ///< Frame count since last FPS update
 	float m_Fps {0.f};            ///< Calculated FPS
+
+	std::vector<SDL_Rect> m_GraphBars;   ///< One bar per graphed frame
+	SDL_Rect m_GraphBounds {0, 0, 0, 0}; ///< Graph background rect
 };
 
 #endif // DEBUG_UI_HPP
\ No newline at end of file